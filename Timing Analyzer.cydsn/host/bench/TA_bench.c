@@ -0,0 +1,470 @@
+/**
+* \file <TA_bench.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Host benchmark of the Timing Analyzer's own overhead
+*
+* Reports the per-call cost of TA_start / TA_pause / TA_resume / TA_stop in every TA_Mode_t.
+* Each call is timed in a batch loop with its precondition restored by a plain state store,
+* the cost of an empty loop doing the same store is subtracted. The best of several rounds
+* is reported to suppress scheduler noise.
+*
+* Usage: ta_bench [-n iterations] [-r rounds] [-c monotonic|stepped] [--csv]
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "project.h"
+#include "TimingAnalyzer.h"
+#include "TimingAnalyzer_fast.h"
+#include "Pins.h"
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+#define BENCH_DEFAULT_ITERATIONS    (1000000UL)
+#define BENCH_DEFAULT_ROUNDS        (5U)
+#define BENCH_NS_PER_S              (1000000000.0)
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+typedef enum {
+    BENCH_OP_START,
+    BENCH_OP_PAUSE,
+    BENCH_OP_RESUME,
+    BENCH_OP_STOP,
+    BENCH_OP_COUNT
+} BENCH_Op_t;
+
+typedef enum {
+    BENCH_API_RUNTIME,      /**< \TA_start, TA_pause, ... */
+    BENCH_API_INLINE,       /**< \TA_START_DWT, ... of TimingAnalyzer_fast.h */
+    BENCH_API_GATED_OFF     /**< \TA_IF_ENABLED around the inline DWT variants, category disabled */
+} BENCH_Api_t;
+
+typedef enum {
+    BENCH_FMT_EVENT_TEXT,   /**< \Trace event line of TATRACE_printAll */
+    BENCH_FMT_EVENT_WIRE,   /**< \Trace event record of TATRACE_sendAll */
+    BENCH_FMT_STATUS_TEXT,  /**< \First line of TA_printStatus */
+    BENCH_FMT_STATUS_WIRE,  /**< \Stats record of TA_sendAll */
+    BENCH_FMT_COUNT
+} BENCH_Format_t;
+
+typedef struct {
+    TA_Mode_t mode;
+    TA_PinFunc_t pin;
+    BENCH_Api_t api;
+    boolean_t hist;         /**< \Histogram attached */
+    const char *name;
+} BENCH_Mode_t;
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+static const BENCH_Mode_t bench_modes[] = {
+    { TA_MODE_DWT,          NULL,           BENCH_API_RUNTIME,  FALSE,  "TA_MODE_DWT"           },
+    { TA_MODE_DWT_PIN,      Pin_1_Control,  BENCH_API_RUNTIME,  FALSE,  "TA_MODE_DWT_PIN"       },
+    { TA_MODE_DWT_PIN,      Pin_1_BitBand,  BENCH_API_RUNTIME,  FALSE,  "TA_MODE_DWT_PIN (bb)"  },
+    { TA_MODE_SYSTICK,      NULL,           BENCH_API_RUNTIME,  FALSE,  "TA_MODE_SYSTICK"       },
+    { TA_MODE_SYSTICK_PIN,  Pin_2_Control,  BENCH_API_RUNTIME,  FALSE,  "TA_MODE_SYSTICK_PIN"   },
+    { TA_MODE_PIN,          Pin_3_Control,  BENCH_API_RUNTIME,  FALSE,  "TA_MODE_PIN"           },
+    { TA_MODE_DWT,          NULL,           BENCH_API_INLINE,   FALSE,  "TA_*_DWT (inline)"     },
+    { TA_MODE_DWT_PIN,      Pin_1_Control,  BENCH_API_INLINE,   FALSE,  "TA_*_DWT_PIN (inline)" },
+    { TA_MODE_DWT_PIN,      Pin_1_BitBand,  BENCH_API_INLINE,   FALSE,  "TA_*_DWT_PIN (bb)"     },
+    { TA_MODE_DWT,          NULL,           BENCH_API_RUNTIME,  TRUE,   "TA_MODE_DWT + hist"    },
+    { TA_MODE_DWT,          NULL,           BENCH_API_GATED_OFF, FALSE, "TA_IF_ENABLED (off)"   },
+};
+
+static const char *const bench_op_names[BENCH_OP_COUNT] = { "TA_start", "TA_pause", "TA_resume", "TA_stop" };
+
+static const char *const bench_format_names[BENCH_FMT_COUNT] = {
+    "trace event, text", "trace event, binary", "status, text", "status, binary"
+};
+
+static TA_t bench_analyzer;
+static TA_Hist_t bench_hist;
+static volatile uint32_t bench_sink;    // Keeps the baseline loop from being optimized away
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+static double BENCH__now(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * BENCH_NS_PER_S + (double)ts.tv_nsec;
+}
+
+/**
+ * Func to time one batch of a single operation.
+ * \param BENCH_Op_t const op           : [IN] operation to time, BENCH_OP_COUNT times the empty baseline
+ * \param unsigned long const iterations: [IN] batch size
+ * \return elapsed ns for the whole batch
+*/
+static double BENCH__batch(BENCH_Op_t const op, unsigned long const iterations)
+{
+    TA_t *const me = &bench_analyzer;
+    unsigned long i;
+    double t0 = BENCH__now();
+
+    switch (op)
+    {
+        case BENCH_OP_START:
+            for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_STOPPED; (void)TA_start(me); }
+            break;
+        case BENCH_OP_PAUSE:
+            for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_RUNNING; (void)TA_pause(me); }
+            break;
+        case BENCH_OP_RESUME:
+            for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_PAUSED; (void)TA_resume(me); }
+            break;
+        case BENCH_OP_STOP:
+            for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_RUNNING; (void)TA_stop(me); }
+            break;
+        default:
+            for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_RUNNING; bench_sink = (uint32_t)i; }
+            break;
+    }
+
+    return BENCH__now() - t0;
+}
+
+/**
+ * Func to time one batch of a single operation of the inline DWT variants.
+ * \param BENCH_Op_t const op           : [IN] operation to time
+ * \param TA_Mode_t const mode          : [IN] TA_MODE_DWT or TA_MODE_DWT_PIN
+ * \param TA_PinFunc_t const pin        : [IN] Pin_1_Control or Pin_1_BitBand (inline PIN_1_BB_WRITE)
+ * \param unsigned long const iterations: [IN] batch size
+ * \return elapsed ns for the whole batch
+*/
+static double BENCH__batchInline(BENCH_Op_t const op, TA_Mode_t const mode, TA_PinFunc_t const pin, unsigned long const iterations)
+{
+    TA_t *const me = &bench_analyzer;
+    unsigned long i;
+    double t0 = BENCH__now();
+
+    if (TA_MODE_DWT == mode)
+    {
+        switch (op)
+        {
+            case BENCH_OP_START:  for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_STOPPED; TA_START_DWT(me); } break;
+            case BENCH_OP_PAUSE:  for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_RUNNING; TA_PAUSE_DWT(me); } break;
+            case BENCH_OP_RESUME: for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_PAUSED;  TA_RESUME_DWT(me); } break;
+            default:              for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_RUNNING; TA_STOP_DWT(me); } break;
+        }
+    }
+    else if (Pin_1_BitBand == pin)
+    {
+        switch (op)
+        {
+            case BENCH_OP_START:  for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_STOPPED; TA_START_DWT_PIN(me, PIN_1_BB_WRITE); } break;
+            case BENCH_OP_PAUSE:  for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_RUNNING; TA_PAUSE_DWT_PIN(me, PIN_1_BB_WRITE); } break;
+            case BENCH_OP_RESUME: for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_PAUSED;  TA_RESUME_DWT_PIN(me, PIN_1_BB_WRITE); } break;
+            default:              for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_RUNNING; TA_STOP_DWT_PIN(me, PIN_1_BB_WRITE); } break;
+        }
+    }
+    else
+    {
+        switch (op)
+        {
+            case BENCH_OP_START:  for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_STOPPED; TA_START_DWT_PIN(me, Pin_1_Control); } break;
+            case BENCH_OP_PAUSE:  for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_RUNNING; TA_PAUSE_DWT_PIN(me, Pin_1_Control); } break;
+            case BENCH_OP_RESUME: for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_PAUSED;  TA_RESUME_DWT_PIN(me, Pin_1_Control); } break;
+            default:              for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_RUNNING; TA_STOP_DWT_PIN(me, Pin_1_Control); } break;
+        }
+    }
+
+    return BENCH__now() - t0;
+}
+
+/**
+ * Func to time one batch of a single inline DWT operation behind a disabled category guard.
+ * \param BENCH_Op_t const op           : [IN] operation to time
+ * \param unsigned long const iterations: [IN] batch size
+ * \return elapsed ns for the whole batch
+*/
+static double BENCH__batchGated(BENCH_Op_t const op, unsigned long const iterations)
+{
+    TA_t *const me = &bench_analyzer;
+    unsigned long i;
+    double t0;
+
+    TA_disableCategories(TA_CAT_ISR);
+    t0 = BENCH__now();
+
+    switch (op)
+    {
+        case BENCH_OP_START:  for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_STOPPED; TA_IF_ENABLED(TA_CAT_ISR, TA_START_DWT(me)); } break;
+        case BENCH_OP_PAUSE:  for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_RUNNING; TA_IF_ENABLED(TA_CAT_ISR, TA_PAUSE_DWT(me)); } break;
+        case BENCH_OP_RESUME: for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_PAUSED;  TA_IF_ENABLED(TA_CAT_ISR, TA_RESUME_DWT(me)); } break;
+        default:              for (i = 0UL; i < iterations; i++) { me->state = TA_STATE_RUNNING; TA_IF_ENABLED(TA_CAT_ISR, TA_STOP_DWT(me)); } break;
+    }
+
+    t0 = BENCH__now() - t0;
+    TA_enableCategories(TA_CAT_ISR);
+    return t0;
+}
+
+/**
+ * Func to time a batch of bare counter reads, i.e. the cost the host simulation adds per DWT access.
+ * \param unsigned long const iterations: [IN] batch size
+ * \return elapsed ns for the whole batch
+*/
+static double BENCH__counterRead(unsigned long const iterations)
+{
+    unsigned long i;
+    double t0 = BENCH__now();
+
+    for (i = 0UL; i < iterations; i++)
+    {
+        bench_sink = DWT->CYCCNT;
+    }
+    return BENCH__now() - t0;
+}
+
+/**
+ * Func to time the formatting of one output record as text (snprintf) or binary frame (TAWire.h).
+ * Binary frames are finished (CRC, COBS) whenever they are full, that cost is included.
+ * \param BENCH_Format_t const format   : [IN] record type and format
+ * \param unsigned long const iterations: [IN] batch size
+ * \param double *const bytes           : [OUT] bytes on the wire per record
+ * \return elapsed ns for the whole batch
+*/
+static double BENCH__format(BENCH_Format_t const format, unsigned long const iterations, double *const bytes)
+{
+    char text[150];
+    uint8_t payload[TA_CFG_WIRE_FRAME_SIZE];
+    uint8_t encoded[TAWIRE_ENCODED_SIZE(TA_CFG_WIRE_FRAME_SIZE)];
+    TA_WireFrame_t frame;
+    TA_TraceEvent_t event = { 0UL, 1U, (uint8_t)TATRACE_EVT_START, 0U };
+    TA_WireStats_t stats = { 1U, (uint8_t)TA_MODE_DWT, (uint8_t)TA_STATE_STOPPED, 48009019UL, 1000UL, 1200UL, 1900UL, 1310UL, 42UL };
+    unsigned long total = 0UL;
+    unsigned long i;
+    double t0;
+
+    (void)TAWIRE_begin(&frame, payload, sizeof(payload));
+    t0 = BENCH__now();
+
+    for (i = 0UL; i < iterations; i++)
+    {
+        // Typical distance of ISR events: a few hundred cycles
+        event.timestamp += 700UL + (uint32_t)(i & 0xFFUL);
+        event.type       = (uint8_t)(i & 3UL);
+        stats.elapsed   += 1310UL;
+
+        switch (format)
+        {
+            case BENCH_FMT_EVENT_TEXT:
+                total += (unsigned long)snprintf(text, sizeof(text), "Trace: %10lu | %-6s | ctx %3u | %s\r\n",
+                    (unsigned long)event.timestamp, "START", event.ctx, "ISR 1ms DWT Func Test");
+                break;
+            case BENCH_FMT_STATUS_TEXT:
+                total += (unsigned long)snprintf(text, sizeof(text), "Name: %s | State: %s | Elapsed time: %u.%06ums | Cycles: %u (raw %u)\r\n",
+                    "ISR 1ms DWT Func Test", "STOPPED", (unsigned int)(stats.elapsed / BCLK__BUS_CLK__KHZ),
+                    (unsigned int)(((stats.elapsed % BCLK__BUS_CLK__KHZ) * 1000000UL) / BCLK__BUS_CLK__KHZ),
+                    (unsigned int)stats.elapsed, (unsigned int)stats.elapsed);
+                break;
+            default:
+                if (((format == BENCH_FMT_EVENT_WIRE) ? TAWIRE_putEvent(&frame, &event) : TAWIRE_putStats(&frame, &stats)) != RC_SUCCESS)
+                {
+                    total += TAWIRE_finish(&frame, encoded, sizeof(encoded));
+                    (void)((format == BENCH_FMT_EVENT_WIRE) ? TAWIRE_putEvent(&frame, &event) : TAWIRE_putStats(&frame, &stats));
+                }
+                break;
+        }
+    }
+    total += TAWIRE_finish(&frame, encoded, sizeof(encoded));
+    bench_sink = (uint32_t)text[0];
+
+    *bytes = (double)total / (double)iterations;
+    return BENCH__now() - t0;
+}
+
+static double BENCH__best(double const current, double const candidate)
+{
+    return ((current < 0.0) || (candidate < current)) ? candidate : current;
+}
+
+static void BENCH__usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-n iterations] [-r rounds] [-c monotonic|stepped] [--csv]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long iterations = BENCH_DEFAULT_ITERATIONS;
+    unsigned int rounds = BENCH_DEFAULT_ROUNDS;
+    int csv = 0;
+    const char *counter = "monotonic";
+    double result[sizeof(bench_modes) / sizeof(bench_modes[0])][BENCH_OP_COUNT];
+    double format_ns[BENCH_FMT_COUNT];
+    double format_bytes[BENCH_FMT_COUNT];
+    double baseline = -1.0;
+    double counter_read = -1.0;
+    unsigned int m, op, r;
+    int i;
+
+    // Parse command line
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc))
+        {
+            iterations = strtoul(argv[++i], NULL, 0);
+        }
+        else if ((strcmp(argv[i], "-r") == 0) && (i + 1 < argc))
+        {
+            rounds = (unsigned int)strtoul(argv[++i], NULL, 0);
+        }
+        else if ((strcmp(argv[i], "-c") == 0) && (i + 1 < argc))
+        {
+            counter = argv[++i];
+        }
+        else if (strcmp(argv[i], "--csv") == 0)
+        {
+            csv = 1;
+        }
+        else
+        {
+            BENCH__usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if ((iterations == 0UL) || (rounds == 0U))
+    {
+        BENCH__usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    HOST_selectCounter((strcmp(counter, "stepped") == 0) ? HOST_COUNTER_STEPPED : HOST_COUNTER_MONOTONIC);
+    HOST_setUartEnabled(0U);
+    if (TA_init() != RC_SUCCESS)
+    {
+        fprintf(stderr, "TA_init failed\n");
+        return EXIT_FAILURE;
+    }
+
+    // Measure every operation in every mode, keep the best round
+    for (m = 0U; m < sizeof(bench_modes) / sizeof(bench_modes[0]); m++)
+    {
+        if (TA_create(&bench_analyzer, bench_modes[m].mode, bench_modes[m].pin, bench_modes[m].name) != RC_SUCCESS)
+        {
+            fprintf(stderr, "TA_create failed for %s\n", bench_modes[m].name);
+            return EXIT_FAILURE;
+        }
+        if (bench_modes[m].hist == TRUE)
+        {
+            (void)TA_attachHistogram(&bench_analyzer, &bench_hist);
+        }
+        for (op = 0U; op < BENCH_OP_COUNT; op++)
+        {
+            result[m][op] = -1.0;
+            for (r = 0U; r < rounds; r++)
+            {
+                double ns;
+
+                if (BENCH_API_INLINE == bench_modes[m].api)
+                {
+                    ns = BENCH__batchInline((BENCH_Op_t)op, bench_modes[m].mode, bench_modes[m].pin, iterations);
+                }
+                else if (BENCH_API_GATED_OFF == bench_modes[m].api)
+                {
+                    ns = BENCH__batchGated((BENCH_Op_t)op, iterations);
+                }
+                else
+                {
+                    ns = BENCH__batch((BENCH_Op_t)op, iterations);
+                }
+                result[m][op] = BENCH__best(result[m][op], ns);
+            }
+        }
+        (void)TA_delete(&bench_analyzer);
+    }
+    for (r = 0U; r < rounds; r++)
+    {
+        baseline = BENCH__best(baseline, BENCH__batch(BENCH_OP_COUNT, iterations));
+        counter_read = BENCH__best(counter_read, BENCH__counterRead(iterations));
+    }
+    for (op = 0U; op < BENCH_FMT_COUNT; op++)
+    {
+        format_ns[op] = -1.0;
+        for (r = 0U; r < rounds; r++)
+        {
+            format_ns[op] = BENCH__best(format_ns[op], BENCH__format((BENCH_Format_t)op, iterations, &format_bytes[op]));
+        }
+        format_ns[op] /= (double)iterations;
+    }
+    baseline /= (double)iterations;
+    counter_read /= (double)iterations;
+
+    HOST_setUartEnabled(1U);
+
+    // Report in ns per call, baseline already subtracted
+    if (csv != 0)
+    {
+        printf("mode");
+        for (op = 0U; op < BENCH_OP_COUNT; op++)
+        {
+            printf(",%s_ns", bench_op_names[op]);
+        }
+        printf("\n");
+    }
+    else
+    {
+        printf("Timing Analyzer host benchmark: %lu iterations, best of %u, %s counter\n", iterations, rounds, counter);
+        printf("Loop baseline %.2f ns, simulated DWT->CYCCNT read %.2f ns (included in DWT modes)\n", baseline, counter_read);
+        printf("Calibrated self-overhead: TA_MODE_DWT %lu cycles, TA_MODE_DWT_PIN %lu cycles, TA_MODE_SYSTICK %lu cycles, inline DWT %lu cycles\n\n",
+               (unsigned long)TA_getOverhead(TA_MODE_DWT), (unsigned long)TA_getOverhead(TA_MODE_DWT_PIN),
+               (unsigned long)TA_getOverhead(TA_MODE_SYSTICK), (unsigned long)ta_g_fast_overhead);
+        printf("%-22s", "mode [ns/call]");
+        for (op = 0U; op < BENCH_OP_COUNT; op++)
+        {
+            printf("%11s", bench_op_names[op]);
+        }
+        printf("\n");
+    }
+
+    for (m = 0U; m < sizeof(bench_modes) / sizeof(bench_modes[0]); m++)
+    {
+        printf(csv ? "%s" : "%-22s", bench_modes[m].name);
+        for (op = 0U; op < BENCH_OP_COUNT; op++)
+        {
+            double ns = (result[m][op] / (double)iterations) - baseline;
+            printf(csv ? ",%.2f" : "%11.2f", (ns > 0.0) ? ns : 0.0);
+        }
+        printf("\n");
+    }
+
+    // Output formats, text vs. binary wire format
+    if (csv == 0)
+    {
+        printf("\n%-22s%11s%11s\n", "format [per record]", "bytes", "ns");
+    }
+    for (op = 0U; op < BENCH_FMT_COUNT; op++)
+    {
+        printf(csv ? "%s,%.2f,%.2f\n" : "%-22s%11.2f%11.2f\n", bench_format_names[op], format_bytes[op], format_ns[op]);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* [TA_bench.c] END OF FILE */
@@ -0,0 +1,18 @@
+/**
+* \file <DMA_LOG_dma.h>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Host stand-in for the generated DMA_LOG component, the channel is modelled in HostSim.c
+*/
+
+#ifndef HOST_DMA_LOG_DMA_H
+#define HOST_DMA_LOG_DMA_H
+
+#include "project.h"
+
+uint8 DMA_LOG_DmaInitialize(uint8 BurstCount, uint8 ReqestPerBurst, uint16 UpperSrcAddress, uint16 UpperDestAddress);
+
+#endif /* HOST_DMA_LOG_DMA_H */
+
+/* [DMA_LOG_dma.h] END OF FILE */
@@ -0,0 +1,815 @@
+/**
+* \file <HostSim.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Host (Linux) simulation of the PSoC 5LP peripherals used by the Timing Analyzer
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <time.h>
+#include "project.h"
+#include "HostSim.h"
+#include "DMA_LOG_dma.h"
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+#define HOST_NS_PER_US              (1000ULL)
+#define HOST_NS_PER_S               (1000000000ULL)
+#define HOST_SYSTICK_CALLBACKS      (5U)
+#define HOST_SYSTICK_RELOAD_1MS     (BCLK__BUS_CLK__HZ / 1000U)
+#define HOST_DEFAULT_STEP           (1U)
+#define HOST_EXCEPTION_PENDSV       (14U)
+#define HOST_EXCEPTION_SYSTICK      (15U)
+#define HOST_SYS_VECTORS            (16U)
+#define HOST_DMA_TDS                (8U)
+#define HOST_UART_BYTE_CYCLES       (BCLK__BUS_CLK__HZ / 11520U)    // 10 bit per byte at 115200 baud
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+typedef struct
+{
+    uint16 count;                   // Bytes of the TD
+    uint8 next;                     // Next TD of the chain, CY_DMA_DISABLE_TD ends it
+    uint8 config;                   // CY_DMA_TD_INC_SRC_ADR / CY_DMA_TD_INC_DST_ADR
+    uint16 source;                  // Slot of HOST_dmaAddress
+    uint16 destination;
+} HOST_DmaTd_t;
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+CoreDebug_Type HOST_coreDebug;
+volatile uint8 HOST_prt0Dr;
+volatile uint8 HOST_prt2Dr;
+volatile uint8 HOST_prt3Dr;
+volatile uint8 HOST_uartTxData;
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+/* DWT model */
+static DWT_Type host_dwt;
+static uint32_t host_dwt_published = 0UL;   // Value of CYCCNT after the last refresh, detects writes by the application
+static uint32_t host_dwt_base = 0UL;        // CYCCNT = raw + base
+
+/* Counter backends */
+static uint32_t HOST__monotonicSource(void);
+static uint32_t HOST__steppedSource(void);
+static HOST_CounterSource_t host_source = HOST__monotonicSource;
+static HOST_Counter_t host_counter = HOST_COUNTER_MONOTONIC;
+static uint32_t host_last_raw = 0UL;
+static uint64_t host_time = 0ULL;           // Simulated bus clock cycles, not affected by CYCCNT writes
+static uint64_t host_mono_origin_ns = 0ULL;
+static uint32_t host_stepped_now = 0UL;
+static uint32_t host_step = HOST_DEFAULT_STEP;
+
+/* SysTick model */
+static uint8_t host_systick_enabled = 0U;
+static uint8_t host_systick_active = 0U;    // Prevents nested delivery from within a callback
+static uint32_t host_systick_reload = HOST_SYSTICK_RELOAD_1MS;
+static uint64_t host_systick_next = 0ULL;
+static uint64_t host_systick_flag_time = 0ULL;  // Time of the last COUNTFLAG read, a reload after it sets the flag
+static cySysTickCallback host_systick_callbacks[HOST_SYSTICK_CALLBACKS];
+
+/* SysTick and SCB register views, refreshed on every access */
+static SysTick_Type host_systick_regs;
+static SCB_Type host_scb_regs;
+
+/* Exception context */
+static uint32_t host_ipsr = 0UL;
+static uint8_t host_primask = 0U;           // Set inside CyEnterCriticalSection
+static uint8_t host_pendsv = 0U;            // PendSV pending, latched from the PENDSVSET write
+static cyisraddress host_sys_vectors[HOST_SYS_VECTORS];
+
+/* Pins and UART */
+static uint8_t host_pin_level[HOST_MAX_PINS];
+static uint32_t host_pin_edges[HOST_MAX_PINS];
+static HOST_PinHook_t host_pin_hook = 0;
+static uint8_t host_uart_enabled = 1U;
+
+/* DMA model - one channel (DMA_LOG), the UART takes one byte per HOST_UART_BYTE_CYCLES */
+static HOST_DmaTd_t host_dma_tds[HOST_DMA_TDS];
+static uint8_t host_dma_td_count = 0U;
+static volatile void *host_dma_addresses[HOST_DMA_ADDRESSES];
+static uint8_t host_dma_address_next = 0U;
+static uint8_t host_dma_initial = CY_DMA_INVALID_TD;
+static uint8_t host_dma_current = CY_DMA_INVALID_TD;    // TD being executed, CY_DMA_INVALID_TD while the chain is idle
+static uint16_t host_dma_done = 0U;                     // Bytes of the current TD moved so far
+static uint64_t host_dma_time = 0ULL;                   // Simulated time up to which bytes were moved
+
+/* Interrupt components - registered, but only fired by the application itself */
+static cyisraddress host_isr_1ms = 0;
+static cyisraddress host_isr_2secs = 0;
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+static uint64_t HOST__nowNs(void);
+static uint32_t HOST__readRaw(void);
+static void HOST__writePin(uint8_t const pin, uint8_t const value);
+static void HOST__servicePendSv(void);
+static void HOST__serviceDma(void);
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * Func to read CLOCK_MONOTONIC in ns.
+ * \param None
+ * \return nanoseconds
+*/
+static uint64_t HOST__nowNs(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * HOST_NS_PER_S) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * Func monotonic backend - host time scaled to bus clock cycles, wraps like CYCCNT.
+ * \param None
+ * \return raw cycle count
+*/
+static uint32_t HOST__monotonicSource(void)
+{
+    if (host_mono_origin_ns == 0ULL)
+    {
+        host_mono_origin_ns = HOST__nowNs();
+    }
+    return (uint32_t)(((HOST__nowNs() - host_mono_origin_ns) * BCLK__BUS_CLK__MHZ) / HOST_NS_PER_US);
+}
+
+/**
+ * Func stepped backend - every read costs host_step cycles.
+ * \param None
+ * \return raw cycle count
+*/
+static uint32_t HOST__steppedSource(void)
+{
+    host_stepped_now += host_step;
+    return host_stepped_now;
+}
+
+/**
+ * Func to sample the active backend and advance the simulated time.
+ * \param None
+ * \return raw cycle count
+*/
+static uint32_t HOST__readRaw(void)
+{
+    uint32_t raw = host_source();
+
+    host_time += (uint64_t)(uint32_t)(raw - host_last_raw);
+    host_last_raw = raw;
+    return raw;
+}
+
+void HOST_selectCounter(HOST_Counter_t const counter)
+{
+    host_counter = counter;
+    if (HOST_COUNTER_STEPPED == counter)
+    {
+        host_source = HOST__steppedSource;
+        host_stepped_now = 0UL;
+    }
+    else
+    {
+        host_source = HOST__monotonicSource;
+        host_counter = HOST_COUNTER_MONOTONIC;
+        host_mono_origin_ns = 0ULL;
+    }
+    host_last_raw = host_source();
+}
+
+void HOST_setCounterSource(HOST_CounterSource_t const source)
+{
+    if (source != 0)
+    {
+        host_source = source;
+        host_counter = HOST_COUNTER_CUSTOM;
+        host_last_raw = host_source();
+    }
+}
+
+void HOST_setStep(uint32_t const cycles)
+{
+    host_step = cycles;
+}
+
+void HOST_advance(uint32_t const cycles)
+{
+    host_stepped_now += cycles;
+    if (HOST_COUNTER_STEPPED == host_counter)
+    {
+        // Taken over without a read step; ticks which became due run now, like their ISR during the modelled code
+        host_time    += cycles;
+        host_last_raw = host_stepped_now;
+        HOST_serviceSysTick();
+    }
+    HOST__servicePendSv();
+}
+
+void HOST_setUartEnabled(uint8_t const enable)
+{
+    host_uart_enabled = enable;
+}
+
+void HOST_setPinHook(HOST_PinHook_t const hook)
+{
+    host_pin_hook = hook;
+}
+
+uint8_t HOST_getPinLevel(uint8_t const pin)
+{
+    return (pin < HOST_MAX_PINS) ? host_pin_level[pin] : 0U;
+}
+
+uint32_t HOST_getPinEdges(uint8_t const pin)
+{
+    return (pin < HOST_MAX_PINS) ? host_pin_edges[pin] : 0UL;
+}
+
+void HOST_serviceSysTick(void)
+{
+    uint32_t i;
+    uint32_t ipsr;
+
+    if ((host_systick_enabled == 0U) || (host_systick_active != 0U))
+    {
+        return;
+    }
+
+    // Callbacks run in the SysTick exception context
+    host_systick_active = 1U;
+    ipsr = host_ipsr;
+    host_ipsr = HOST_EXCEPTION_SYSTICK;
+    while (host_time >= host_systick_next)
+    {
+        host_systick_next += (uint64_t)host_systick_reload + 1ULL;
+        for (i = 0U; i < HOST_SYSTICK_CALLBACKS; i++)
+        {
+            if (host_systick_callbacks[i] != 0)
+            {
+                host_systick_callbacks[i]();
+            }
+        }
+    }
+    host_ipsr = ipsr;
+    host_systick_active = 0U;
+}
+
+void HOST_setIpsr(uint32_t const exception)
+{
+    host_ipsr = exception;
+    HOST__servicePendSv();      // Return to thread mode tail-chains a pending PendSV
+}
+
+/**
+ * Func to run the PendSV vector when it was pended. It has the lowest priority, so it is only taken in
+ * thread mode outside of a critical section, otherwise it stays pending until then.
+ * \param None
+ * \return None
+*/
+static void HOST__servicePendSv(void)
+{
+    // The application writes PENDSVSET into the register view after HOST_scb() returned
+    if ((host_scb_regs.ICSR & SCB_ICSR_PENDSVSET_Msk) != 0UL)
+    {
+        host_scb_regs.ICSR &= ~SCB_ICSR_PENDSVSET_Msk;
+        host_pendsv = 1U;
+    }
+    if ((host_pendsv != 0U) && (host_ipsr == 0UL) && (host_primask == 0U) && (host_sys_vectors[HOST_EXCEPTION_PENDSV] != 0))
+    {
+        host_pendsv = 0U;
+        host_ipsr   = HOST_EXCEPTION_PENDSV;
+        host_sys_vectors[HOST_EXCEPTION_PENDSV]();
+        host_ipsr   = 0UL;
+    }
+}
+
+uint32_t __get_IPSR(void)
+{
+    return host_ipsr;
+}
+
+/**
+ * Func to bring the DWT model up to date, called for every DWT-> access of the application.
+ * A value written to CYCCNT by the application is taken over as new counter value.
+ * \param None
+ * \return pointer to the DWT register model
+*/
+DWT_Type *HOST_dwt(void)
+{
+    uint32_t raw = HOST__readRaw();
+
+    // Counter stopped or written by the application - continue from the register value
+    if (((host_dwt.CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0UL) || (host_dwt.CYCCNT != host_dwt_published))
+    {
+        host_dwt_base = host_dwt.CYCCNT - raw;
+    }
+    host_dwt.CYCCNT = raw + host_dwt_base;
+    host_dwt_published = host_dwt.CYCCNT;
+
+    HOST_serviceSysTick();
+    HOST__servicePendSv();
+
+    return &host_dwt;
+}
+
+/**
+ * Func to bring the SysTick register view up to date. VAL counts down from LOAD to 0 within each
+ * period, a tick which is due but not yet delivered keeps counting into the next period.
+ * \param None
+ * \return pointer to the SysTick register model
+*/
+SysTick_Type *HOST_sysTick(void)
+{
+    uint64_t period = (uint64_t)host_systick_reload + 1ULL;
+    uint64_t since;
+
+    (void)HOST__readRaw();
+    since = host_time + period - host_systick_next;     // Cycles since the last reload
+
+    host_systick_regs.CTRL = host_systick_enabled;
+    host_systick_regs.LOAD = host_systick_reload;
+    host_systick_regs.VAL  = host_systick_reload - (uint32_t)(since % period);
+
+    return &host_systick_regs;
+}
+
+/**
+ * Func to bring the SCB register view up to date, PENDSTSET is set while a SysTick is due but not delivered.
+ * A PENDSVSET written through the previous pointer is taken over as pending PendSV.
+ * \param None
+ * \return pointer to the SCB register model
+*/
+SCB_Type *HOST_scb(void)
+{
+    (void)HOST__readRaw();
+    if ((host_scb_regs.ICSR & SCB_ICSR_PENDSVSET_Msk) != 0UL)
+    {
+        host_pendsv = 1U;       // Written since the last access, delivered by HOST__servicePendSv
+    }
+    host_scb_regs.ICSR = ((host_systick_enabled != 0U) && (host_time >= host_systick_next)) ? SCB_ICSR_PENDSTSET_Msk : 0UL;
+
+    return &host_scb_regs;
+}
+
+/*****************************************************************************/
+/* CyLib                                                                     */
+/*****************************************************************************/
+
+void CySysTickInit(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < HOST_SYSTICK_CALLBACKS; i++)
+    {
+        host_systick_callbacks[i] = 0;
+    }
+    host_systick_reload = HOST_SYSTICK_RELOAD_1MS;
+}
+
+void CySysTickStart(void)
+{
+    CySysTickInit();
+    CySysTickEnable();
+}
+
+void CySysTickEnable(void)
+{
+    (void)HOST__readRaw();
+    host_systick_next = host_time + (uint64_t)host_systick_reload + 1ULL;
+    host_systick_flag_time = host_time;
+    host_systick_enabled = 1U;
+}
+
+void CySysTickStop(void)
+{
+    host_systick_enabled = 0U;
+}
+
+void CySysTickSetReload(uint32 value)
+{
+    host_systick_reload = value;
+}
+
+uint32 CySysTickGetReload(void)
+{
+    return host_systick_reload;
+}
+
+// Reads and clears the COUNTFLAG: set by any reload since the last read, delivered or not, like CTRL bit 16
+uint32 CySysTickGetCountFlag(void)
+{
+    uint64_t period = (uint64_t)host_systick_reload + 1ULL;
+    uint64_t reload;
+    uint32 flag = 0U;
+
+    (void)HOST__readRaw();
+    if (host_systick_enabled != 0U)
+    {
+        reload = host_time - ((host_time + period - host_systick_next) % period);     // Last reload up to now
+        flag = (reload > host_systick_flag_time) ? 1U : 0U;
+        host_systick_flag_time = host_time;
+    }
+    return flag;
+}
+
+cySysTickCallback CySysTickSetCallback(uint32 number, cySysTickCallback function)
+{
+    cySysTickCallback previous = 0;
+
+    if (number < HOST_SYSTICK_CALLBACKS)
+    {
+        previous = host_systick_callbacks[number];
+        host_systick_callbacks[number] = function;
+    }
+    return previous;
+}
+
+void CyDelay(uint32 milliseconds)
+{
+    if (HOST_COUNTER_MONOTONIC == host_counter)
+    {
+        struct timespec ts;
+        ts.tv_sec = (time_t)(milliseconds / 1000U);
+        ts.tv_nsec = (long)(milliseconds % 1000U) * 1000000L;
+        (void)nanosleep(&ts, 0);
+    }
+    else
+    {
+        HOST_advance(milliseconds * BCLK__BUS_CLK__KHZ);
+    }
+    (void)HOST__readRaw();
+    HOST_serviceSysTick();
+}
+
+void CyDelayUs(uint16 microseconds)
+{
+    if (HOST_COUNTER_MONOTONIC == host_counter)
+    {
+        struct timespec ts;
+        ts.tv_sec = 0;
+        ts.tv_nsec = (long)microseconds * 1000L;
+        (void)nanosleep(&ts, 0);
+    }
+    else
+    {
+        HOST_advance((uint32_t)microseconds * BCLK__BUS_CLK__MHZ);
+    }
+    (void)HOST__readRaw();
+    HOST_serviceSysTick();
+}
+
+uint8 CyEnterCriticalSection(void)
+{
+    uint8 saved = host_primask;
+
+    host_primask = 1U;      // Single threaded host - only keeps PendSV pending
+    return saved;
+}
+
+void CyExitCriticalSection(uint8 savedIntrStatus)
+{
+    host_primask = savedIntrStatus;
+    HOST__servicePendSv();
+}
+
+cyisraddress CyIntSetSysVector(uint8 number, cyisraddress address)
+{
+    cyisraddress previous = 0;
+
+    if (number < HOST_SYS_VECTORS)
+    {
+        previous = host_sys_vectors[number];
+        host_sys_vectors[number] = address;
+    }
+    return previous;
+}
+
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority)
+{
+    (void)IRQn;             // Priorities are not modelled, PendSV is always the lowest
+    (void)priority;
+}
+
+/*****************************************************************************/
+/* Pins                                                                      */
+/*****************************************************************************/
+
+/**
+ * Func to model a pin write, counts edges and reports them to the pin hook.
+ * \param uint8_t const pin     : [IN] virtual pin index
+ * \param uint8_t const value   : [IN] new level, only bit 0 is used like the generated _Write()
+ * \return None
+*/
+static void HOST__writePin(uint8_t const pin, uint8_t const value)
+{
+    uint8_t level = value & 1U;
+
+    if (host_pin_level[pin] != level)
+    {
+        host_pin_level[pin] = level;
+        host_pin_edges[pin]++;
+    }
+    if (host_pin_hook != 0)
+    {
+        host_pin_hook(pin, level, HOST_dwt()->CYCCNT);
+    }
+}
+
+void RED_LED_Write(uint8 value)
+{
+    HOST__writePin(HOST_PIN_RED, value);
+}
+
+void YELLOW_LED_Write(uint8 value)
+{
+    HOST__writePin(HOST_PIN_YELLOW, value);
+}
+
+void GREEN_LED_Write(uint8 value)
+{
+    HOST__writePin(HOST_PIN_GREEN, value);
+}
+
+void HOST_writeBitBand(uintptr_t const dr, uint8_t const shift, uint32_t const state)
+{
+    volatile uint8 *const reg = (volatile uint8 *)dr;
+
+    // Like the alias word: bit 0 of the stored value sets or clears the one bit
+    *reg = (uint8)((*reg & ~(1U << shift)) | ((state & 1U) << shift));
+
+    if ((dr == RED_LED__DR) && (shift == RED_LED__SHIFT))
+    {
+        HOST__writePin(HOST_PIN_RED, (uint8_t)state);
+    }
+    else if ((dr == YELLOW_LED__DR) && (shift == YELLOW_LED__SHIFT))
+    {
+        HOST__writePin(HOST_PIN_YELLOW, (uint8_t)state);
+    }
+    else if ((dr == GREEN_LED__DR) && (shift == GREEN_LED__SHIFT))
+    {
+        HOST__writePin(HOST_PIN_GREEN, (uint8_t)state);
+    }
+}
+
+/*****************************************************************************/
+/* UART_LOG - stdout sink                                                    */
+/*****************************************************************************/
+
+void UART_LOG_Start(void)
+{
+}
+
+void UART_LOG_Stop(void)
+{
+    (void)fflush(stdout);
+}
+
+void UART_LOG_PutChar(uint8 txDataByte)
+{
+    if (host_uart_enabled != 0U)
+    {
+        (void)fputc((int)txDataByte, stdout);
+    }
+}
+
+void UART_LOG_PutString(const char8 string[])
+{
+    if (host_uart_enabled != 0U)
+    {
+        (void)fputs(string, stdout);
+    }
+}
+
+void UART_LOG_PutArray(const uint8 string[], uint8 byteCount)
+{
+    if (host_uart_enabled != 0U)
+    {
+        (void)fwrite(string, 1U, byteCount, stdout);
+    }
+}
+
+void UART_LOG_WriteTxData(uint8 txDataByte)
+{
+    UART_LOG_PutChar(txDataByte);
+}
+
+uint8 UART_LOG_ReadTxStatus(void)
+{
+    return UART_LOG_TX_STS_FIFO_NOT_FULL;      // stdout takes every byte at once
+}
+
+/*****************************************************************************/
+/* DMA_LOG and CyDmac                                                        */
+/*****************************************************************************/
+
+uint16_t HOST_dmaAddress(const volatile void *const address)
+{
+    uint16_t slot;
+
+    for (slot = 0U; slot < HOST_DMA_ADDRESSES; slot++)
+    {
+        if (host_dma_addresses[slot] == address)
+        {
+            return slot;
+        }
+    }
+    // Round robin, the chain which still uses the oldest slot has finished long ago
+    slot = host_dma_address_next;
+    host_dma_address_next = (uint8_t)((host_dma_address_next + 1U) % HOST_DMA_ADDRESSES);
+    host_dma_addresses[slot] = (volatile void *)address;
+    return slot;
+}
+
+/**
+ * Func to move the bytes the channel has transferred up to now, one per UART byte time.
+ * \param None
+ * \return None
+*/
+static void HOST__serviceDma(void)
+{
+    uint64_t bytes;
+
+    (void)HOST__readRaw();
+    if (host_dma_current == CY_DMA_INVALID_TD)
+    {
+        return;
+    }
+    bytes = (host_time - host_dma_time) / HOST_UART_BYTE_CYCLES;
+    host_dma_time += bytes * HOST_UART_BYTE_CYCLES;
+
+    while ((bytes != 0ULL) && (host_dma_current < HOST_DMA_TDS))
+    {
+        HOST_DmaTd_t const *const td = &host_dma_tds[host_dma_current];
+
+        if (host_dma_done < td->count)
+        {
+            volatile uint8 const *source = (volatile uint8 const *)host_dma_addresses[td->source % HOST_DMA_ADDRESSES];
+            volatile uint8 *destination  = (volatile uint8 *)host_dma_addresses[td->destination % HOST_DMA_ADDRESSES];
+            uint8 data = source[((td->config & CY_DMA_TD_INC_SRC_ADR) != 0U) ? host_dma_done : 0U];
+
+            if (destination == UART_LOG_TXDATA_PTR)
+            {
+                UART_LOG_WriteTxData(data);
+            }
+            else
+            {
+                destination[((td->config & CY_DMA_TD_INC_DST_ADR) != 0U) ? host_dma_done : 0U] = data;
+            }
+            host_dma_done++;
+            bytes--;
+        }
+        if (host_dma_done >= td->count)
+        {
+            host_dma_current = td->next;
+            host_dma_done    = 0U;
+        }
+    }
+    if (host_dma_current >= HOST_DMA_TDS)
+    {
+        host_dma_current = CY_DMA_INVALID_TD;           // CY_DMA_DISABLE_TD reached, the chain is done
+    }
+}
+
+uint8 DMA_LOG_DmaInitialize(uint8 BurstCount, uint8 ReqestPerBurst, uint16 UpperSrcAddress, uint16 UpperDestAddress)
+{
+    (void)BurstCount;           // One byte per UART request is the only mode modelled
+    (void)ReqestPerBurst;
+    (void)UpperSrcAddress;
+    (void)UpperDestAddress;
+    host_dma_current = CY_DMA_INVALID_TD;
+    return 0U;
+}
+
+uint8 CyDmaTdAllocate(void)
+{
+    return (host_dma_td_count < HOST_DMA_TDS) ? host_dma_td_count++ : CY_DMA_INVALID_TD;
+}
+
+cystatus CyDmaTdSetConfiguration(uint8 tdHandle, uint16 transferCount, uint8 nextTd, uint8 configuration)
+{
+    if (tdHandle >= host_dma_td_count)
+    {
+        return CYRET_BAD_PARAM;
+    }
+    host_dma_tds[tdHandle].count  = transferCount;
+    host_dma_tds[tdHandle].next   = nextTd;
+    host_dma_tds[tdHandle].config = configuration;
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaTdSetAddress(uint8 tdHandle, uint16 source, uint16 destination)
+{
+    if (tdHandle >= host_dma_td_count)
+    {
+        return CYRET_BAD_PARAM;
+    }
+    host_dma_tds[tdHandle].source      = source;
+    host_dma_tds[tdHandle].destination = destination;
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaChSetInitialTd(uint8 chHandle, uint8 startTd)
+{
+    (void)chHandle;
+    host_dma_initial = startTd;
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaChEnable(uint8 chHandle, uint8 preserveTds)
+{
+    (void)chHandle;
+    (void)preserveTds;
+    (void)HOST__readRaw();
+    host_dma_current = host_dma_initial;
+    host_dma_done    = 0U;
+    host_dma_time    = host_time;
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaChStatus(uint8 chHandle, uint8 *currentTd, uint8 *state)
+{
+    (void)chHandle;
+    HOST__serviceDma();
+    if (currentTd != NULL)
+    {
+        *currentTd = host_dma_current;
+    }
+    if (state != NULL)
+    {
+        *state = (host_dma_current != CY_DMA_INVALID_TD) ? CY_DMA_STATUS_CHAIN_ACTIVE : 0U;
+    }
+    return CYRET_SUCCESS;
+}
+
+/*****************************************************************************/
+/* Timers and interrupt components                                           */
+/*****************************************************************************/
+
+void Timer_1ms_Start(void)
+{
+}
+
+void Timer_1ms_Stop(void)
+{
+}
+
+uint8 Timer_1ms_ReadStatusRegister(void)
+{
+    return 0U;
+}
+
+void Timer_2secs_Start(void)
+{
+}
+
+void Timer_2secs_Stop(void)
+{
+}
+
+uint8 Timer_2secs_ReadStatusRegister(void)
+{
+    return 0U;
+}
+
+void isr_1ms_StartEx(cyisraddress address)
+{
+    host_isr_1ms = address;
+}
+
+void isr_1ms_ClearPending(void)
+{
+}
+
+void isr_2secs_StartEx(cyisraddress address)
+{
+    host_isr_2secs = address;
+}
+
+void isr_2secs_ClearPending(void)
+{
+}
+
+/* [HostSim.c] END OF FILE */
@@ -0,0 +1,151 @@
+/**
+* \file <HostSim.h>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Host (Linux) simulation of the PSoC 5LP peripherals used by the Timing Analyzer
+*
+* Replaces the DWT cycle counter, the SysTick timer, the LED pins and UART_LOG with
+* software models, so TimingAnalyzer.c can be built and benchmarked without a board.
+* The cycle counter is pluggable: a monotonic clock scaled to BCLK__BUS_CLK__HZ, a
+* deterministic stepped counter or any user supplied source.
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+#ifndef HOSTSIM_H
+#define HOSTSIM_H
+
+#include <stdint.h>
+
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### Defines/Macros
+#define HOST_PIN_RED            (0U)    /**< \Virtual pin behind RED_LED_Write / Pin_1_Control */
+#define HOST_PIN_YELLOW         (1U)    /**< \Virtual pin behind YELLOW_LED_Write / Pin_2_Control */
+#define HOST_PIN_GREEN          (2U)    /**< \Virtual pin behind GREEN_LED_Write / Pin_3_Control */
+#define HOST_MAX_PINS           (3U)
+#define HOST_DMA_ADDRESSES      (8U)    /**< \Addresses of HOST_dmaAddress, 2 TDs with source and destination are live at once */
+
+//####################### Enumerations
+/**
+* \Simulated cycle counter backends
+*/
+typedef enum {
+    HOST_COUNTER_MONOTONIC,     /**< \CLOCK_MONOTONIC scaled to the bus clock (real host time). */
+    HOST_COUNTER_STEPPED,       /**< \Advances by a fixed step on every read (deterministic). */
+    HOST_COUNTER_CUSTOM         /**< \Source installed with HOST_setCounterSource(). */
+} HOST_Counter_t;
+
+typedef uint32_t (*HOST_CounterSource_t)(void);                          /* Free running 32 bit raw counter */
+typedef void (*HOST_PinHook_t)(uint8_t pin, uint8_t level, uint32_t cyccnt); /* Called on every virtual pin write */
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * Func to select one of the built-in counter backends. Resets the simulated time base.
+ * \param HOST_Counter_t const counter  : [IN] HOST_COUNTER_MONOTONIC or HOST_COUNTER_STEPPED
+ * \return None
+*/
+void HOST_selectCounter(HOST_Counter_t const counter);
+
+/**
+ * Func to plug in an own raw cycle source (e.g. rdtsc or a trace replay).
+ * \param HOST_CounterSource_t const source : [IN] raw counter, must not be NULL
+ * \return None
+*/
+void HOST_setCounterSource(HOST_CounterSource_t const source);
+
+/**
+ * Func to set the number of cycles the stepped counter advances on every read.
+ * \param uint32_t const cycles     : [IN] cycles per read, 0 freezes the counter between HOST_advance() calls
+ * \return None
+*/
+void HOST_setStep(uint32_t const cycles);
+
+/**
+ * Func to move the stepped counter forward, e.g. to model the code under measurement. SysTicks which
+ * become due in between are delivered before it returns.
+ * \param uint32_t const cycles     : [IN] number of bus clock cycles
+ * \return None
+*/
+void HOST_advance(uint32_t const cycles);
+
+/**
+ * Func to enable/disable the stdout sink of UART_LOG (benchmarks mute it).
+ * \param uint8_t const enable      : [IN] 0 mutes, everything else writes to stdout
+ * \return None
+*/
+void HOST_setUartEnabled(uint8_t const enable);
+
+/**
+ * Func to install a hook which is called on every virtual pin write.
+ * \param HOST_PinHook_t const hook : [IN] hook, NULL removes it
+ * \return None
+*/
+void HOST_setPinHook(HOST_PinHook_t const hook);
+
+/**
+ * Func to read the current level of a virtual pin.
+ * \param uint8_t const pin         : [IN] HOST_PIN_RED .. HOST_PIN_GREEN
+ * \return pin level 0/1, 0 for an invalid pin
+*/
+uint8_t HOST_getPinLevel(uint8_t const pin);
+
+/**
+ * Func to read the number of level changes seen on a virtual pin.
+ * \param uint8_t const pin         : [IN] HOST_PIN_RED .. HOST_PIN_GREEN
+ * \return number of edges, 0 for an invalid pin
+*/
+uint32_t HOST_getPinEdges(uint8_t const pin);
+
+/**
+ * Func to model a store to the bit-band alias word of one port bit (PINS_BITBAND_WRITE of Pins.h).
+ * The bit of the simulated data register changes, a LED pin behind it is written like by its _Write().
+ * \param uintptr_t const dr        : [IN] data register, CYREG_PRTn_DR
+ * \param uint8_t const shift       : [IN] bit number
+ * \param uint32_t const state      : [IN] only bit 0 is used
+ * \return None
+*/
+void HOST_writeBitBand(uintptr_t const dr, uint8_t const shift, uint32_t const state);
+
+/**
+ * Func to set the exception number returned by __get_IPSR(), e.g. while the application calls an ISR itself.
+ * \param uint32_t const exception  : [IN] 0 for thread mode, 15 SysTick, 16+n for IRQn
+ * \return None
+*/
+void HOST_setIpsr(uint32_t const exception);
+
+/**
+ * Func to deliver all SysTick callbacks which became due in simulated time.
+ * Called implicitly on every DWT access and from CyDelay().
+ * \param None
+ * \return None
+*/
+void HOST_serviceSysTick(void);
+
+/**
+ * Func to map a host address to the 16 bit address of a DMA TD (CyDmaTdSetAddress). The upper half of
+ * a PSoC address comes from the channel configuration, which can not hold a host pointer; the model
+ * keeps the last HOST_DMA_ADDRESSES addresses and hands out their slot instead.
+ * \param const volatile void *const address : [IN] source or destination of a TD
+ * \return 16 bit address for CyDmaTdSetAddress
+*/
+uint16_t HOST_dmaAddress(const volatile void *const address);
+
+#endif /* HOSTSIM_H */
+
+/* [HostSim.h] END OF FILE */
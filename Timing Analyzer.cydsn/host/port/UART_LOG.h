@@ -0,0 +1,11 @@
+/**
+* \file <UART_LOG.h>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Host stand-in for the generated UART_LOG component, see project.h
+*/
+
+#include "project.h"
+
+/* [UART_LOG.h] END OF FILE */
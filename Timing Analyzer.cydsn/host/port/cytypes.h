@@ -0,0 +1,47 @@
+/**
+* \file <cytypes.h>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Host stand-in for the PSoC Creator cytypes.h
+*
+* Provides the Cypress base types (uint8, reg32, ...) on top of <stdint.h> for the host build.
+*/
+
+#ifndef HOST_CYTYPES_H
+#define HOST_CYTYPES_H
+
+#include <stdint.h>
+
+typedef uint8_t             uint8;
+typedef uint16_t            uint16;
+typedef uint32_t            uint32;
+typedef int8_t              int8;
+typedef int16_t             int16;
+typedef int32_t             int32;
+typedef char                char8;
+
+typedef volatile uint8      reg8;
+typedef volatile uint16     reg16;
+typedef volatile uint32     reg32;
+
+typedef void (* cyisraddress)(void);
+typedef uint32              cystatus;
+
+#define CYRET_SUCCESS           (0x00u)
+#define CYRET_BAD_PARAM         (0x01u)
+
+#define LO16(x)                 ((uint16)((uint32)(x) & 0xFFFFu))
+#define HI16(x)                 ((uint16)((uint32)(x) >> 16u))
+
+#define CY_ISR(FuncName)        void FuncName (void)
+#define CY_ISR_PROTO(FuncName)  void FuncName (void)
+
+#define CY_GET_REG8(addr)           (*((const reg8 *)(addr)))
+#define CY_SET_REG8(addr, value)    (*((reg8 *)(addr)) = (uint8)(value))
+#define CY_GET_REG32(addr)          (*((const reg32 *)(addr)))
+#define CY_SET_REG32(addr, value)   (*((reg32 *)(addr)) = (uint32)(value))
+
+#endif /* HOST_CYTYPES_H */
+
+/* [cytypes.h] END OF FILE */
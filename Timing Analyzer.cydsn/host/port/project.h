@@ -0,0 +1,193 @@
+/**
+* \file <project.h>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Host stand-in for the PSoC Creator generated project.h
+*
+* Declares exactly the part of the generated API (CyLib, core_cm3, LED pins, UART_LOG, timers,
+* isr components) which is used by the application, backed by the models in HostSim.c.
+* The DWT unit is reached through HOST_dwt(), which brings CYCCNT up to date before every
+* access, so the unmodified DWT->CYCCNT expressions of the target code work on the host.
+* SysTick->VAL and the PENDSTSET bit of SCB->ICSR are derived from the same simulated time.
+* A PENDSVSET write to SCB->ICSR runs the PendSV vector once thread mode is reached outside a
+* critical section.
+* DMA transfers address memory with 16 bit values like the PHUB; on the host they are handles of
+* HOST_dmaAddress, see LogDma.c.
+* Register addresses (CYREG_...) point to plain host variables.
+*/
+
+#ifndef HOST_PROJECT_H
+#define HOST_PROJECT_H
+
+#include "cytypes.h"
+#include "HostSim.h"
+
+/*****************************************************************************/
+/* cyfitter.h                                                                */
+/*****************************************************************************/
+#define BCLK__BUS_CLK__HZ           24000000U
+#define BCLK__BUS_CLK__KHZ          24000U
+#define BCLK__BUS_CLK__MHZ          24U
+
+#define RED_LED__DR                 CYREG_PRT0_DR
+#define RED_LED__SHIFT              6u
+#define GREEN_LED__DR               CYREG_PRT0_DR
+#define GREEN_LED__SHIFT            7u
+#define YELLOW_LED__DR              CYREG_PRT2_DR
+#define YELLOW_LED__SHIFT           0u
+
+/*****************************************************************************/
+/* cydevice_trm.h                                                            */
+/*****************************************************************************/
+extern volatile uint8 HOST_prt0Dr;             /* Port 0 data register, RED_LED and GREEN_LED */
+extern volatile uint8 HOST_prt2Dr;             /* Port 2 data register, YELLOW_LED */
+extern volatile uint8 HOST_prt3Dr;             /* Port 3 data register, e.g. the ID bus of TA_CFG_ID_BUS */
+
+#define CYDEV_SRAM_BASE             (0x1FFF8000u)
+#define CYDEV_PERIPH_BASE           (0x40000000u)
+
+#define CYREG_PRT0_DR               ((uintptr_t)&HOST_prt0Dr)
+#define CYREG_PRT2_DR               ((uintptr_t)&HOST_prt2Dr)
+#define CYREG_PRT3_DR               ((uintptr_t)&HOST_prt3Dr)
+
+/*****************************************************************************/
+/* core_cm3.h                                                                */
+/*****************************************************************************/
+typedef struct
+{
+    volatile uint32_t CTRL;         /* Offset: 0x000 (R/W)  Control Register */
+    volatile uint32_t CYCCNT;       /* Offset: 0x004 (R/W)  Cycle Count Register */
+} DWT_Type;
+
+typedef struct
+{
+    volatile uint32_t DEMCR;        /* Offset: 0x00C (R/W)  Debug Exception and Monitor Control Register */
+} CoreDebug_Type;
+
+typedef struct
+{
+    volatile uint32_t CTRL;         /* Offset: 0x000 (R/W)  SysTick Control and Status Register */
+    volatile uint32_t LOAD;         /* Offset: 0x004 (R/W)  SysTick Reload Value Register */
+    volatile uint32_t VAL;          /* Offset: 0x008 (R/W)  SysTick Current Value Register */
+} SysTick_Type;
+
+typedef struct
+{
+    volatile uint32_t ICSR;         /* Offset: 0x004 (R/W)  Interrupt Control and State Register */
+} SCB_Type;
+
+#define DWT_CTRL_CYCCNTENA_Msk      (0x1UL)
+#define CoreDebug_DEMCR_TRCENA_Msk  (1UL << 24U)
+#define SCB_ICSR_PENDSTSET_Msk      (1UL << 26U)
+#define SCB_ICSR_PENDSVSET_Msk      (1UL << 28U)
+#define __NVIC_PRIO_BITS            3U
+
+typedef enum
+{
+    PendSV_IRQn                 = -2,   /* 14 Cortex-M3 Pend SV Interrupt */
+    SysTick_IRQn                = -1    /* 15 Cortex-M3 System Tick Interrupt */
+} IRQn_Type;
+
+extern DWT_Type *HOST_dwt(void);
+extern SysTick_Type *HOST_sysTick(void);
+extern SCB_Type *HOST_scb(void);
+extern CoreDebug_Type HOST_coreDebug;
+
+#define DWT                         (HOST_dwt())
+#define SysTick                     (HOST_sysTick())
+#define SCB                         (HOST_scb())
+#define CoreDebug                   (&HOST_coreDebug)
+
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority);
+
+/* core_cmFunc.h */
+uint32_t __get_IPSR(void);
+
+/*****************************************************************************/
+/* CyLib.h                                                                   */
+/*****************************************************************************/
+typedef void (*cySysTickCallback)(void);
+
+void CySysTickStart(void);
+void CySysTickInit(void);
+void CySysTickEnable(void);
+void CySysTickStop(void);
+void CySysTickSetReload(uint32 value);
+uint32 CySysTickGetReload(void);
+uint32 CySysTickGetCountFlag(void);
+cySysTickCallback CySysTickSetCallback(uint32 number, cySysTickCallback function);
+
+void CyDelay(uint32 milliseconds);
+void CyDelayUs(uint16 microseconds);
+
+uint8 CyEnterCriticalSection(void);
+void CyExitCriticalSection(uint8 savedIntrStatus);
+
+/* CyLib.h - system exception vectors */
+#define CY_INT_PEND_SV_IRQ          (14u)
+
+cyisraddress CyIntSetSysVector(uint8 number, cyisraddress address);
+
+#define CyGlobalIntEnable           {;}
+#define CyGlobalIntDisable          {;}
+
+/*****************************************************************************/
+/* CyDmac.h - one channel, TDs move bytes at the UART_LOG rate (HostSim.c)   */
+/*****************************************************************************/
+#define CY_DMA_INVALID_CHANNEL      (0xFFu)
+#define CY_DMA_INVALID_TD           (0xFFu)
+#define CY_DMA_DISABLE_TD           (0xFEu)
+#define CY_DMA_TD_INC_SRC_ADR       (0x08u)
+#define CY_DMA_TD_INC_DST_ADR       (0x04u)
+#define CY_DMA_STATUS_CHAIN_ACTIVE  (0x01u)
+
+uint8 CyDmaTdAllocate(void);
+cystatus CyDmaTdSetConfiguration(uint8 tdHandle, uint16 transferCount, uint8 nextTd, uint8 configuration);
+cystatus CyDmaTdSetAddress(uint8 tdHandle, uint16 source, uint16 destination);
+cystatus CyDmaChSetInitialTd(uint8 chHandle, uint8 startTd);
+cystatus CyDmaChEnable(uint8 chHandle, uint8 preserveTds);
+cystatus CyDmaChStatus(uint8 chHandle, uint8 *currentTd, uint8 *state);
+
+/*****************************************************************************/
+/* Pins (RED_LED.h, YELLOW_LED.h, GREEN_LED.h)                               */
+/*****************************************************************************/
+void RED_LED_Write(uint8 value);
+void YELLOW_LED_Write(uint8 value);
+void GREEN_LED_Write(uint8 value);
+
+/*****************************************************************************/
+/* UART_LOG.h                                                                */
+/*****************************************************************************/
+#define UART_LOG_TX_BUFFER_SIZE     (4u)
+#define UART_LOG_TX_STS_FIFO_NOT_FULL   (uint8)(0x01u << 0x03u)
+
+extern volatile uint8 HOST_uartTxData;         /* TX data register, written by the DMA model */
+#define UART_LOG_TXDATA_PTR         (&HOST_uartTxData)
+
+void UART_LOG_Start(void);
+void UART_LOG_Stop(void);
+void UART_LOG_PutChar(uint8 txDataByte);
+void UART_LOG_PutString(const char8 string[]);
+void UART_LOG_PutArray(const uint8 string[], uint8 byteCount);
+void UART_LOG_WriteTxData(uint8 txDataByte);
+uint8 UART_LOG_ReadTxStatus(void);
+
+/*****************************************************************************/
+/* Timer_1ms.h, Timer_2secs.h, isr_1ms.h, isr_2secs.h                        */
+/*****************************************************************************/
+void Timer_1ms_Start(void);
+void Timer_1ms_Stop(void);
+uint8 Timer_1ms_ReadStatusRegister(void);
+void Timer_2secs_Start(void);
+void Timer_2secs_Stop(void);
+uint8 Timer_2secs_ReadStatusRegister(void);
+
+void isr_1ms_StartEx(cyisraddress address);
+void isr_1ms_ClearPending(void);
+void isr_2secs_StartEx(cyisraddress address);
+void isr_2secs_ClearPending(void);
+
+#endif /* HOST_PROJECT_H */
+
+/* [project.h] END OF FILE */
@@ -0,0 +1,144 @@
+/**
+* \file <TA_test.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Host unit tests of the Timing Analyzer
+*
+* Runs the analyzer against the stepped counter of the host port with a step of 0, so the
+* measured cycles are exactly the ones handed to HOST_advance and the calibrated overhead is 0.
+* The tests of each feature live in their own TA_test_*.c file and are listed in test_cases.
+* Every check prints the failing expression with its line, the exit code is the number of failures.
+*
+* Usage: ta_test (or make test)
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include <stdio.h>
+#include "TA_test.h"
+#include "TATrace.h"
+#include "LogDma.h"
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+typedef struct {
+    const char *name;
+    void (*run)(void);
+} TEST_Case_t;
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+static unsigned int test_checks = 0U;
+static unsigned int test_failures = 0U;
+static const char *test_current = "";
+
+static const TEST_Case_t test_cases[] = {
+    { "Welford run statistics",             TEST_welford },
+    { "Histogram percentiles",              TEST_percentile },
+    { "Wire frame round trip",              TEST_wire },
+    { "Nested and preempted self time",     TEST_nesting },
+    { "Activation period",                  TEST_period },
+    { "Registry free list",                 TEST_registry },
+    { "Trace names after id reuse",         TEST_traceNames },
+    { "SysTick time base",                  TEST_sysTick },
+    { "Execution budget",                   TEST_budget },
+    { NULL_PTR, NULL_PTR }
+};
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * Func to count one check and report it when it failed.
+ * \param int const cond            : [IN] result of the check
+ * \param const char *const text    : [IN] checked expression
+ * \param int const line            : [IN] source line
+ * \return None
+*/
+void TEST_check(int const cond, const char *const text, int const line)
+{
+    test_checks++;
+    if (cond == 0)
+    {
+        test_failures++;
+        printf("FAIL %s: line %d: %s\n", test_current, line, text);
+    }
+}
+
+/**
+ * Func to run one measured region of a given length.
+ * \param TA_t *const me            : [IN/OUT] analyzer
+ * \param uint32_t const cycles     : [IN] length of the region
+ * \return None
+*/
+void TEST_run(TA_t *const me, uint32_t const cycles)
+{
+    (void)TA_start(me);
+    HOST_advance(cycles);
+    (void)TA_stop(me);
+}
+
+/**
+ * Func to drain the trace ring, so every test starts with an empty one.
+ * \param None
+ * \return None
+*/
+void TEST_drainTrace(void)
+{
+    TA_TraceEvent_t event;
+
+    while (TATRACE_read(&event) == RC_SUCCESS)
+    {
+    }
+}
+
+/**
+ * Main function of the tests.
+ * \param None
+ * \return number of failed checks
+*/
+int main(void)
+{
+    HOST_selectCounter(HOST_COUNTER_STEPPED);
+    HOST_setStep(0UL);
+    HOST_setUartEnabled(0U);
+    UART_LOG_Start();
+    LogDma_Init();
+    (void)TA_init();
+    LogDma_Flush();
+    HOST_setUartEnabled(1U);
+
+    TEST_CHECK(TA_getOverhead(TA_MODE_DWT) == 0UL);
+
+    for (uint8_t i = 0U; test_cases[i].name != NULL_PTR; i++)
+    {
+        unsigned int const before = test_failures;
+
+        test_current = test_cases[i].name;
+        TEST_drainTrace();
+        test_cases[i].run();
+        printf("%-36s %s\n", test_cases[i].name, (test_failures == before) ? "ok" : "FAILED");
+    }
+
+    printf("%u checks, %u failed\n", test_checks, test_failures);
+
+    return (test_failures > 255U) ? 255 : (int)test_failures;
+}
+
+/* [TA_test.c] END OF FILE */
@@ -0,0 +1,134 @@
+/**
+* \file <TA_test.h>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Shared helpers of the host unit tests
+*
+* Every TA_test_*.c file holds the tests of one feature and is listed in test_cases of TA_test.c.
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+#ifndef TA_TEST_H
+#define TA_TEST_H
+
+#include "project.h"
+#include "TimingAnalyzer.h"
+#include "HostSim.h"
+
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### Defines/Macros
+#define TEST_CHECK(cond)            TEST_check((cond), #cond, __LINE__)
+#define TEST_ISR_EXCEPTION          (15U)       // SysTick exception number, any value > 0 is an ISR context
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * Func to count one check and report it when it failed.
+ * \param int const cond            : [IN] result of the check
+ * \param const char *const text    : [IN] checked expression
+ * \param int const line            : [IN] source line
+ * \return None
+*/
+void TEST_check(int const cond, const char *const text, int const line);
+
+/**
+ * Func to run one measured region of a given length.
+ * \param TA_t *const me            : [IN/OUT] analyzer
+ * \param uint32_t const cycles     : [IN] length of the region
+ * \return None
+*/
+void TEST_run(TA_t *const me, uint32_t const cycles);
+
+/**
+ * Func to drain the trace ring, so every test starts with an empty one.
+ * \param None
+ * \return None
+*/
+void TEST_drainTrace(void);
+
+/* Test groups, one per feature */
+
+/**
+ * Func to check count, mean and sample variance of TA_recordRun, also far away from zero.
+ * \param None
+ * \return None
+*/
+void TEST_welford(void);
+
+/**
+ * Func to check the bucket ranges and the percentiles, directly and through an attached histogram.
+ * \param None
+ * \return None
+*/
+void TEST_percentile(void);
+
+/**
+ * Func to send every record type through TAWIRE_finish (CRC, COBS) and read it back with TAWIRE_decode / TAWIRE_readNext.
+ * \param None
+ * \return None
+*/
+void TEST_wire(void);
+
+/**
+ * Func to check self, child and preemption time of a nested region and of an ISR on top.
+ * \param None
+ * \return None
+*/
+void TEST_nesting(void);
+
+/**
+ * Func to check the start-to-start period, its jitter and the missed activations.
+ * \param None
+ * \return None
+*/
+void TEST_period(void);
+
+/**
+ * Func to check the id free list, the double create and the limit of TA_MAX_ANALYZERS.
+ * \param None
+ * \return None
+*/
+void TEST_registry(void);
+
+/**
+ * Func to check that the events of a deleted analyzer are not printed under the name of the next owner of its id.
+ * The UART_LOG sink of the host port writes to stdout, which is redirected into a file for the drain.
+ * \param None
+ * \return None
+*/
+void TEST_traceNames(void);
+
+/**
+ * Func to check that the sub-ms SysTick time never goes backwards, also read from a SysTick callback
+ * which runs between the reload and the ms increment of SysTick_Handler.
+ * \param None
+ * \return None
+*/
+void TEST_sysTick(void);
+
+/**
+ * Func to check the overrun count and the evidence of the last overrun, also for a run stopped while paused.
+ * \param None
+ * \return None
+*/
+void TEST_budget(void);
+
+#endif /* TA_TEST_H */
+
+/* [TA_test.h] END OF FILE */
@@ -0,0 +1,64 @@
+/**
+* \file <TA_test_budget.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Host unit tests of the execution budget
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "TA_test.h"
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * Func to check the overrun count and the evidence of the last overrun, also for a run stopped while paused.
+ * \param None
+ * \return None
+*/
+void TEST_budget(void)
+{
+    TA_t ta;
+    uint64_t stop;
+
+    TEST_CHECK(TA_create(&ta, TA_MODE_DWT, NULL_PTR, "budget") == RC_SUCCESS);
+    TEST_CHECK(TA_setBudget(&ta, 100UL, NULL_PTR, NULL_PTR) == RC_SUCCESS);
+
+    TEST_run(&ta, 100UL);
+    TEST_CHECK(ta.budget.overruns == 0UL);
+    TEST_run(&ta, 150UL);
+    TEST_CHECK((ta.budget.overruns == 1UL) && (ta.budget.last_run == 150UL));
+    TEST_CHECK(ta.budget.last_time == TA_getCycles64());
+
+    // Stopped long after the pause: the overrun is dated at the stop, not at the pause
+    TEST_CHECK(TA_start(&ta) == RC_SUCCESS);
+    HOST_advance(120UL);
+    TEST_CHECK(TA_pause(&ta) == RC_SUCCESS);
+    HOST_advance(5000UL);
+    TEST_CHECK(TA_stop(&ta) == RC_SUCCESS);
+    stop = TA_getCycles64();
+    TEST_CHECK((ta.budget.overruns == 2UL) && (ta.budget.last_run == 120UL));
+    TEST_CHECK(ta.budget.last_time == stop);
+
+    TEST_CHECK(TA_setBudget(&ta, 0UL, NULL_PTR, NULL_PTR) == RC_SUCCESS);
+    TEST_run(&ta, 150UL);
+    TEST_CHECK(ta.budget.overruns == 0UL);
+    TEST_CHECK(TA_delete(&ta) == RC_SUCCESS);
+}
+
+/* [TA_test_budget.c] END OF FILE */
@@ -0,0 +1,105 @@
+/**
+* \file <TA_test_hist.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Unit tests of the run time histogram and its percentiles
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "TA_test.h"
+#include "TAHist.h"
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * Func to check the bucket ranges and the percentiles, directly and through an attached histogram.
+ * \param None
+ * \return None
+*/
+void TEST_percentile(void)
+{
+    static TA_Hist_t hist;
+    TA_t ta;
+
+    // The buckets cover all values without gap or overlap
+    TEST_CHECK(TAHIST_getBucketLow(0UL) == 0UL);
+    for (uint32_t b = 0UL; b < TAHIST_BUCKETS; b++)
+    {
+        TEST_CHECK(TAHIST_getBucket(TAHIST_getBucketLow(b)) == b);
+        TEST_CHECK(TAHIST_getBucket(TAHIST_getBucketHigh(b)) == b);
+        if ((b + 1UL) < TAHIST_BUCKETS)
+        {
+            TEST_CHECK(TAHIST_getBucketHigh(b) + 1UL == TAHIST_getBucketLow(b + 1UL));
+        }
+    }
+    TEST_CHECK(TAHIST_getBucketHigh(TAHIST_BUCKETS - 1UL) == 0xFFFFFFFFUL);
+
+    // Small values have exact buckets
+    TEST_CHECK(TAHIST_clear(&hist) == RC_SUCCESS);
+    TEST_CHECK(TAHIST_getPercentile(&hist, TAHIST_P50) == 0UL);
+    for (uint8_t i = 0U; i < 90U; i++)
+    {
+        TAHIST_record(&hist, 5UL);
+    }
+    for (uint8_t i = 0U; i < 10U; i++)
+    {
+        TAHIST_record(&hist, 7UL);
+    }
+    TEST_CHECK(hist.total == 100UL);
+    TEST_CHECK(TAHIST_getPercentile(&hist, TAHIST_P50) == 5UL);
+    TEST_CHECK(TAHIST_getPercentile(&hist, TAHIST_P90) == 5UL);
+    TEST_CHECK(TAHIST_getPercentile(&hist, TAHIST_P99) == 7UL);
+    TEST_CHECK(TAHIST_getPercentile(&hist, TAHIST_P100) == 7UL);
+
+    // Larger values: never below the exact percentile, at most one sub-bucket above
+    TEST_CHECK(TAHIST_clear(&hist) == RC_SUCCESS);
+    for (uint32_t v = 1UL; v <= 1000UL; v++)
+    {
+        TAHIST_record(&hist, v * 1000UL);
+    }
+    {
+        static const uint16_t permyriads[] = { TAHIST_P50, TAHIST_P90, TAHIST_P99, TAHIST_P999, TAHIST_P100 };
+
+        for (uint8_t i = 0U; i < (sizeof(permyriads) / sizeof(permyriads[0])); i++)
+        {
+            uint32_t const exact = (uint32_t)permyriads[i] / 10UL * 1000UL;
+            uint32_t const p = TAHIST_getPercentile(&hist, permyriads[i]);
+
+            TEST_CHECK(p >= exact);
+            TEST_CHECK(p <= exact + (exact >> TA_CFG_HIST_SUB_BITS));
+        }
+    }
+
+    // TA_stop records every run in the attached histogram
+    TEST_CHECK(TA_create(&ta, TA_MODE_DWT, NULL_PTR, "percentile") == RC_SUCCESS);
+    TEST_CHECK(TA_getPercentile(&ta, TAHIST_P50) == 0UL);
+    TEST_CHECK(TA_attachHistogram(&ta, &hist) == RC_SUCCESS);
+    TEST_CHECK(hist.total == 0UL);
+    for (uint8_t i = 0U; i < 99U; i++)
+    {
+        TEST_run(&ta, 6UL);
+    }
+    TEST_run(&ta, 4000UL);
+    TEST_CHECK(hist.total == 100UL);
+    TEST_CHECK(TA_getPercentile(&ta, TAHIST_P99) == 6UL);
+    TEST_CHECK(TA_getPercentile(&ta, TAHIST_P100) >= 4000UL);
+    TEST_CHECK(TA_delete(&ta) == RC_SUCCESS);
+}
+
+/* [TA_test_hist.c] END OF FILE */
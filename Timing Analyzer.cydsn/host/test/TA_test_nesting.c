@@ -0,0 +1,88 @@
+/**
+* \file <TA_test_nesting.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Unit tests of the nesting and preemption aware self time
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "TA_test.h"
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * Func to check self, child and preemption time of a nested region and of an ISR on top.
+ * \param None
+ * \return None
+*/
+void TEST_nesting(void)
+{
+    TA_t outer;
+    TA_t inner;
+    TA_t isr;
+    uint64_t self;
+
+    TEST_CHECK(TA_create(&outer, TA_MODE_DWT, NULL_PTR, "outer") == RC_SUCCESS);
+    TEST_CHECK(TA_create(&inner, TA_MODE_DWT, NULL_PTR, "inner") == RC_SUCCESS);
+    TEST_CHECK(TA_create(&isr, TA_MODE_DWT, NULL_PTR, "isr") == RC_SUCCESS);
+
+    // outer 1000 | inner 300 | outer 200 | ISR 50 | outer 100
+    TEST_CHECK(TA_start(&outer) == RC_SUCCESS);
+    HOST_advance(1000UL);
+    TEST_run(&inner, 300UL);
+    HOST_advance(200UL);
+    HOST_setIpsr(TEST_ISR_EXCEPTION);
+    TEST_run(&isr, 50UL);
+    HOST_setIpsr(0U);
+    HOST_advance(100UL);
+    TEST_CHECK(TA_stop(&outer) == RC_SUCCESS);
+
+    TEST_CHECK(outer.elapsed_time == 1650ULL);
+    TEST_CHECK(outer.self_time == 1300ULL);            // Without the nested region and the ISR
+    TEST_CHECK(outer.preempt_count == 1UL);            // Only the ISR counts as preemption
+    TEST_CHECK(outer.preempt_time == 50ULL);
+    TEST_CHECK(inner.elapsed_time == 300ULL);
+    TEST_CHECK(inner.self_time == 300ULL);
+    TEST_CHECK(inner.preempt_count == 0UL);
+    TEST_CHECK(isr.ctx == TEST_ISR_EXCEPTION);
+    TEST_CHECK(isr.self_time == 50ULL);
+
+    // A paused region does not charge its parent for the time it is paused, the totals add up over the runs
+    self = outer.self_time;
+    TEST_CHECK(TA_start(&outer) == RC_SUCCESS);
+    TEST_CHECK(TA_start(&inner) == RC_SUCCESS);
+    HOST_advance(100UL);
+    TEST_CHECK(TA_pause(&inner) == RC_SUCCESS);
+    HOST_advance(400UL);
+    TEST_CHECK(TA_resume(&inner) == RC_SUCCESS);
+    HOST_advance(100UL);
+    TEST_CHECK(TA_stop(&inner) == RC_SUCCESS);
+    TEST_CHECK(TA_stop(&outer) == RC_SUCCESS);
+
+    TEST_CHECK(inner.run_time == 200UL);
+    TEST_CHECK(outer.run_time == 600UL);
+    TEST_CHECK(outer.elapsed_time == 1650ULL + 600ULL);
+    TEST_CHECK(outer.self_time - self == 400ULL);
+
+    TEST_CHECK(TA_delete(&isr) == RC_SUCCESS);
+    TEST_CHECK(TA_delete(&inner) == RC_SUCCESS);
+    TEST_CHECK(TA_delete(&outer) == RC_SUCCESS);
+}
+
+/* [TA_test_nesting.c] END OF FILE */
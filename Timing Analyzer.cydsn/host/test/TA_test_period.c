@@ -0,0 +1,66 @@
+/**
+* \file <TA_test_period.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Unit tests of the activation period, jitter and missed activations
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "TA_test.h"
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * Func to check the start-to-start period, its jitter and the missed activations.
+ * \param None
+ * \return None
+*/
+void TEST_period(void)
+{
+    // Start-to-start: 1000, 1000, 3000 (two missed), 1010, 990
+    static const uint32_t gaps[] = { 990UL, 990UL, 2990UL, 1000UL, 980UL };
+    TA_t ta;
+
+    TEST_CHECK(TA_create(&ta, TA_MODE_DWT, NULL_PTR, "period") == RC_SUCCESS);
+    TEST_CHECK(TA_setPeriod(&ta, 1000UL) == RC_SUCCESS);
+    TEST_CHECK(TA_getPeriodMean(&ta) == 0UL);
+
+    for (uint8_t i = 0U; i < (sizeof(gaps) / sizeof(gaps[0])); i++)
+    {
+        TEST_run(&ta, 10UL);
+        HOST_advance(gaps[i]);
+    }
+    TEST_run(&ta, 10UL);
+
+    TEST_CHECK(ta.period.stats.count == 5UL);
+    TEST_CHECK(TA_getPeriodMean(&ta) == 1400UL);       // 7000 / 5
+    TEST_CHECK(ta.period.missed == 2UL);
+    TEST_CHECK(ta.period.max_jitter == 10UL);          // The 3000 is no jitter but missed activations
+    TEST_CHECK(ta.period.stats.min == 990UL);
+    TEST_CHECK(ta.period.stats.max == 3000UL);
+
+    // Restarting the tracking clears it
+    TEST_CHECK(TA_setPeriod(&ta, 1000UL) == RC_SUCCESS);
+    TEST_CHECK((ta.period.stats.count == 0UL) && (ta.period.missed == 0UL));
+
+    TEST_CHECK(TA_setPeriod(NULL_PTR, 1000UL) == RC_ERROR_NULL);
+    TEST_CHECK(TA_delete(&ta) == RC_SUCCESS);
+}
+
+/* [TA_test_period.c] END OF FILE */
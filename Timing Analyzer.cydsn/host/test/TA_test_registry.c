@@ -0,0 +1,87 @@
+/**
+* \file <TA_test_registry.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Unit tests of the analyzer registry and its free list
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "TA_test.h"
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * Func to check the id free list, the double create and the limit of TA_MAX_ANALYZERS.
+ * \param None
+ * \return None
+*/
+void TEST_registry(void)
+{
+    static TA_t all[TA_MAX_ANALYZERS];
+    TA_t extra;
+    uint8_t freed;
+
+    for (uint8_t i = 0U; i < TA_MAX_ANALYZERS; i++)
+    {
+        TEST_CHECK(TA_create(&all[i], TA_MODE_DWT, NULL_PTR, "slot") == RC_SUCCESS);
+        TEST_CHECK(TA_getAnalyzer(all[i].id) == &all[i]);
+    }
+    TEST_CHECK(TA_create(&extra, TA_MODE_DWT, NULL_PTR, "extra") == RC_ERROR_BUFFER_FULL);
+
+    // A second create of a registered analyzer is refused and leaves it untouched
+    TEST_run(&all[0], 10UL);
+    TEST_CHECK(TA_create(&all[0], TA_MODE_DWT, NULL_PTR, "again") == RC_ERROR_BUSY);
+    TEST_CHECK((all[0].stats.count == 1UL) && (strcmp(all[0].name, "slot") == 0));
+
+    // The freed id is the next one handed out
+    freed = all[3].id;
+    TEST_CHECK(TA_delete(&all[3]) == RC_SUCCESS);
+    TEST_CHECK(TA_getAnalyzer(freed) == NULL_PTR);
+    TEST_CHECK(TA_delete(&all[3]) == RC_ERROR_BAD_PARAM);
+    TEST_CHECK(TA_create(&extra, TA_MODE_DWT, NULL_PTR, "extra") == RC_SUCCESS);
+    TEST_CHECK(extra.id == freed);
+    TEST_CHECK(TA_getAnalyzer(freed) == &extra);
+    TEST_CHECK(TA_delete(&extra) == RC_SUCCESS);
+
+    for (uint8_t i = 0U; i < TA_MAX_ANALYZERS; i++)
+    {
+        if (i != 3U)
+        {
+            TEST_CHECK(TA_delete(&all[i]) == RC_SUCCESS);
+        }
+    }
+
+    #if (TA_CFG_ANALYZER_POOL == ON)
+    {
+        TA_Handle_t first;
+        TA_Handle_t second;
+
+        TEST_CHECK(TA_createHandle(&first, TA_MODE_DWT, NULL_PTR, "pool") == RC_SUCCESS);
+        TEST_CHECK(TA_deleteHandle(first) == RC_SUCCESS);
+        TEST_CHECK(TA_deleteHandle(first) == RC_ERROR_BAD_PARAM);
+        TEST_CHECK(TA_createHandle(&second, TA_MODE_DWT, NULL_PTR, "pool") == RC_SUCCESS);
+        TEST_CHECK(second == first);
+        TEST_CHECK(TA_deleteHandle(second) == RC_SUCCESS);
+    }
+    #endif
+}
+
+/* [TA_test_registry.c] END OF FILE */
@@ -0,0 +1,78 @@
+/**
+* \file <TA_test_stats.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Unit tests of the run statistics (count, min, max, Welford mean and variance)
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "TA_test.h"
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * Func to check count, mean and sample variance of TA_recordRun, also far away from zero.
+ * \param None
+ * \return None
+*/
+void TEST_welford(void)
+{
+    static const uint32_t runs[] = { 1UL, 3UL, 5UL, 7UL, 9UL };     // Mean 5, squared deviations 40
+    uint32_t const offsets[] = { 0UL, 1000000000UL };
+    TA_t ta;
+
+    TEST_CHECK(TA_create(&ta, TA_MODE_DWT, NULL_PTR, "welford") == RC_SUCCESS);
+
+    TEST_CHECK(TA_getMean(&ta) == 0UL);
+    TEST_CHECK(TA_getVariance(&ta) == 0ULL);
+
+    for (uint8_t o = 0U; o < (sizeof(offsets) / sizeof(offsets[0])); o++)
+    {
+        TEST_CHECK(TA_resetStats(&ta) == RC_SUCCESS);
+        for (uint8_t i = 0U; i < (sizeof(runs) / sizeof(runs[0])); i++)
+        {
+            TA_recordRun(&ta, offsets[o] + runs[i]);
+        }
+        TEST_CHECK(ta.stats.count == 5UL);
+        TEST_CHECK(ta.stats.min == offsets[o] + 1UL);
+        TEST_CHECK(ta.stats.max == offsets[o] + 9UL);
+        TEST_CHECK(ta.stats.last == offsets[o] + 9UL);
+        TEST_CHECK(TA_getMean(&ta) == offsets[o] + 5UL);
+        TEST_CHECK(TA_getVariance(&ta) == 10ULL);       // 40 / (5 - 1)
+        TEST_CHECK(TA_getStdDev(&ta) == 3UL);
+    }
+
+    // One run has a mean but no variance
+    TEST_CHECK(TA_resetStats(&ta) == RC_SUCCESS);
+    TA_recordRun(&ta, 42UL);
+    TEST_CHECK(TA_getMean(&ta) == 42UL);
+    TEST_CHECK(TA_getVariance(&ta) == 0ULL);
+
+    // TA_stop feeds the same statistics
+    TEST_CHECK(TA_resetStats(&ta) == RC_SUCCESS);
+    TEST_run(&ta, 100UL);
+    TEST_run(&ta, 300UL);
+    TEST_CHECK(ta.stats.count == 2UL);
+    TEST_CHECK(TA_getMean(&ta) == 200UL);
+    TEST_CHECK(TA_getVariance(&ta) == 20000ULL);
+
+    TEST_CHECK(TA_delete(&ta) == RC_SUCCESS);
+}
+
+/* [TA_test_stats.c] END OF FILE */
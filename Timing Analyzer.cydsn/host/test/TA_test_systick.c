@@ -0,0 +1,82 @@
+/**
+* \file <TA_test_systick.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Host unit tests of the SysTick time base
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include "TA_test.h"
+#include "TimingAnalyzer_fast.h"
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+static uint64_t test_systick_last = 0ULL;
+static uint32_t test_systick_calls = 0UL;
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * Func which runs as SysTick callback in front of SysTick_Handler, like any other callback of the
+ * application registered before the analyzer's. The reload has happened, the ms is not counted yet.
+ * \param None
+ * \return None
+*/
+static void TEST__sysTickFirst(void)
+{
+    uint64_t const before = TA_readSysTick();
+
+    TEST_CHECK(before >= test_systick_last);
+    SysTick_Handler();
+    TEST_CHECK(TA_readSysTick() == before);             // The step of the stepped counter is 0
+    test_systick_last = before;
+    test_systick_calls++;
+}
+
+/**
+ * Func to check that the sub-ms SysTick time never goes backwards, also read from a SysTick callback
+ * which runs between the reload and the ms increment of SysTick_Handler.
+ * \param None
+ * \return None
+*/
+void TEST_sysTick(void)
+{
+    TA_t ta;
+
+    TEST_CHECK(TA_create(&ta, TA_MODE_SYSTICK, NULL_PTR, "systick") == RC_SUCCESS);
+    TEST_CHECK(TA_start(&ta) == RC_SUCCESS);            // Starts the SysTick
+    (void)CySysTickSetCallback(0U, TEST__sysTickFirst);
+
+    test_systick_last = TA_readSysTick();
+    for (uint8_t i = 0U; i < 100U; i++)
+    {
+        HOST_advance(7001UL);                           // Odd step, the reloads hit every position of the step
+        uint64_t const now = TA_readSysTick();
+        TEST_CHECK(now >= test_systick_last);
+        test_systick_last = now;
+    }
+    TEST_CHECK(test_systick_calls > 0UL);
+
+    (void)CySysTickSetCallback(0U, SysTick_Handler);
+    TEST_CHECK(TA_stop(&ta) == RC_SUCCESS);
+    TEST_CHECK(TA_delete(&ta) == RC_SUCCESS);
+}
+
+/* [TA_test_systick.c] END OF FILE */
@@ -0,0 +1,93 @@
+/**
+* \file <TA_test_trace.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Unit tests of the trace ring drains
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "TA_test.h"
+#include "TATrace.h"
+#include "LogDma.h"
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+#define TEST_LINE_SIZE              (128U)
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * Func to check that the events of a deleted analyzer are not printed under the name of the next owner of its id.
+ * The UART_LOG sink of the host port writes to stdout, which is redirected into a file for the drain.
+ * \param None
+ * \return None
+*/
+void TEST_traceNames(void)
+{
+    char line[TEST_LINE_SIZE];
+    unsigned int old_lines = 0U;
+    unsigned int next_lines = 0U;
+    FILE *capture = tmpfile();
+    int saved;
+    TA_t old;
+    TA_t next;
+    uint8_t id;
+
+    TEST_CHECK(TA_create(&old, TA_MODE_DWT, NULL_PTR, "old") == RC_SUCCESS);
+    id = old.id;
+    TEST_run(&old, 10UL);
+    TEST_CHECK(TA_delete(&old) == RC_SUCCESS);
+    TEST_CHECK(TA_create(&next, TA_MODE_DWT, NULL_PTR, "next") == RC_SUCCESS);
+    TEST_CHECK(next.id == id);
+    TEST_run(&next, 10UL);
+    TEST_CHECK(TATRACE_getCount() == 6UL);             // CREATE, START, STOP of each owner
+
+    if (capture == NULL)
+    {
+        TEST_CHECK(capture != NULL);
+        return;
+    }
+    fflush(stdout);
+    saved = dup(STDOUT_FILENO);
+    dup2(fileno(capture), STDOUT_FILENO);
+    TEST_CHECK(TATRACE_printAll() == RC_SUCCESS);
+    LogDma_Flush();
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+
+    rewind(capture);
+    while (fgets(line, sizeof(line), capture) != NULL)
+    {
+        old_lines  += (strstr(line, "| <deleted>") != NULL) ? 1U : 0U;
+        next_lines += (strstr(line, "| next") != NULL) ? 1U : 0U;
+    }
+    fclose(capture);
+
+    TEST_CHECK(old_lines == 3U);
+    TEST_CHECK(next_lines == 3U);
+    TEST_CHECK(TATRACE_getCount() == 0UL);
+    TEST_CHECK(TA_delete(&next) == RC_SUCCESS);
+}
+
+/* [TA_test_trace.c] END OF FILE */
@@ -0,0 +1,131 @@
+/**
+* \file <TA_test_wire.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Unit tests of the binary wire format (TAWire.h)
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "TA_test.h"
+#include "TATrace.h"
+#include "TAWire.h"
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+#define TEST_FRAME_SIZE             (TA_CFG_WIRE_FRAME_SIZE)
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * Func to send every record type through TAWIRE_finish (CRC, COBS) and read it back with TAWIRE_decode / TAWIRE_readNext.
+ * \param None
+ * \return None
+*/
+void TEST_wire(void)
+{
+    static const uint32_t varints[] = { 0UL, 1UL, 127UL, 128UL, 16383UL, 16384UL, 0xFFFFFFFFUL };
+    TA_TraceEvent_t const events[] = {
+        { 0xFFFFFF00UL, 3U, TATRACE_EVT_START, 0U },
+        { 0x00000010UL, 3U, TATRACE_EVT_STOP,  TEST_ISR_EXCEPTION },     // Counter wrapped in between
+        { 0x00000010UL, 0U, TATRACE_EVT_PAUSE, 0U }
+    };
+    // max and mean are sent relative to min, the offsets wrap, so even a max below min comes back unchanged
+    TA_WireStats_t const stats = { 3U, TA_MODE_SYSTICK_PIN, TA_STATE_STOPPED, 48009019UL, 1000UL, 1200UL, 1100UL, 0UL, 0UL };
+    uint8_t payload[TEST_FRAME_SIZE];
+    uint8_t out[TAWIRE_ENCODED_SIZE(TEST_FRAME_SIZE)];
+    TA_WireFrame_t frame;
+    TA_WireReader_t reader;
+    TA_WireRecord_t record;
+    uint16_t length;
+    uint16_t records;
+
+    // Varints of every length
+    for (uint8_t i = 0U; i < (sizeof(varints) / sizeof(varints[0])); i++)
+    {
+        uint16_t pos = 0U;
+        uint32_t value = 0UL;
+
+        TEST_CHECK(TAWIRE_begin(&frame, payload, sizeof(payload)) == RC_SUCCESS);
+        TEST_CHECK(TAWIRE_putDropped(&frame, varints[i]) == RC_SUCCESS);
+        length = TAWIRE_finish(&frame, out, sizeof(out));
+        TEST_CHECK(memchr(out, TAWIRE_DELIMITER, length - 1U) == NULL);
+        TEST_CHECK(TAWIRE_decode(out, length - 1U, &records) == RC_SUCCESS);
+        TEST_CHECK((TAWIRE_getVarint(&out[1], records - 1U, &pos, &value) == RC_SUCCESS) && (value == varints[i]));
+    }
+
+    // One frame with a name, events, stats and the dropped counter
+    TEST_CHECK(TAWIRE_begin(&frame, payload, sizeof(payload)) == RC_SUCCESS);
+    TEST_CHECK(TAWIRE_putName(&frame, 3U, "isr,\"adc\"") == RC_SUCCESS);
+    for (uint8_t i = 0U; i < (sizeof(events) / sizeof(events[0])); i++)
+    {
+        TEST_CHECK(TAWIRE_putEvent(&frame, &events[i]) == RC_SUCCESS);
+    }
+    TEST_CHECK(TAWIRE_putStats(&frame, &stats) == RC_SUCCESS);
+    TEST_CHECK(TAWIRE_putDropped(&frame, 7UL) == RC_SUCCESS);
+    length = TAWIRE_finish(&frame, out, sizeof(out));
+    TEST_CHECK(length > 0U);
+    TEST_CHECK(out[length - 1U] == TAWIRE_DELIMITER);
+    TEST_CHECK(memchr(out, TAWIRE_DELIMITER, length - 1U) == NULL);
+
+    TEST_CHECK(TAWIRE_decode(out, length - 1U, &records) == RC_SUCCESS);
+    TEST_CHECK(TAWIRE_readBegin(&reader, out, records) == RC_SUCCESS);
+
+    TEST_CHECK(TAWIRE_readNext(&reader, &record) == RC_SUCCESS);
+    TEST_CHECK((record.tag == TAWIRE_TAG_NAME) && (record.id == 3U) && (strcmp(record.name, "isr,\"adc\"") == 0));
+
+    TEST_CHECK(TAWIRE_readNext(&reader, &record) == RC_SUCCESS);
+    TEST_CHECK((record.tag == TAWIRE_TAG_EVENT) && (record.type == TATRACE_EVT_START) && (record.id == 3U));
+    TEST_CHECK((record.absolute == TRUE) && (record.timestamp == events[0].timestamp) && (record.ctx == 0U));
+
+    TEST_CHECK(TAWIRE_readNext(&reader, &record) == RC_SUCCESS);
+    TEST_CHECK((record.tag == TAWIRE_TAG_EVENT) && (record.type == TATRACE_EVT_STOP) && (record.ctx == TEST_ISR_EXCEPTION));
+    TEST_CHECK((record.absolute == FALSE) && (record.timestamp == (uint32_t)(events[1].timestamp - events[0].timestamp)));
+
+    TEST_CHECK(TAWIRE_readNext(&reader, &record) == RC_SUCCESS);
+    TEST_CHECK((record.tag == TAWIRE_TAG_EVENT) && (record.type == TATRACE_EVT_PAUSE) && (record.id == 0U));
+    TEST_CHECK((record.absolute == FALSE) && (record.timestamp == 0UL));
+
+    TEST_CHECK(TAWIRE_readNext(&reader, &record) == RC_SUCCESS);
+    TEST_CHECK((record.tag == TAWIRE_TAG_STATS) && (record.stats.id == stats.id));
+    TEST_CHECK((record.stats.mode == stats.mode) && (record.stats.state == stats.state));
+    TEST_CHECK((record.stats.elapsed == stats.elapsed) && (record.stats.count == stats.count));
+    TEST_CHECK((record.stats.min == stats.min) && (record.stats.max == stats.max));
+    TEST_CHECK((record.stats.mean == stats.mean) && (record.stats.stddev == stats.stddev));
+
+    TEST_CHECK(TAWIRE_readNext(&reader, &record) == RC_SUCCESS);
+    TEST_CHECK((record.tag == TAWIRE_TAG_DROPPED) && (record.dropped == 7UL));
+
+    TEST_CHECK(TAWIRE_readNext(&reader, &record) == RC_ERROR_BUFFER_EMTPY);
+
+    // A flipped bit is caught by the CRC
+    TEST_CHECK(TAWIRE_begin(&frame, payload, sizeof(payload)) == RC_SUCCESS);
+    TEST_CHECK(TAWIRE_putStats(&frame, &stats) == RC_SUCCESS);
+    length = TAWIRE_finish(&frame, out, sizeof(out));
+    out[length / 2U] ^= 0x10U;
+    TEST_CHECK(TAWIRE_decode(out, length - 1U, &records) == RC_ERROR_BAD_PARAM);
+
+    // Nothing to send
+    TEST_CHECK(TAWIRE_begin(&frame, payload, sizeof(payload)) == RC_SUCCESS);
+    TEST_CHECK(TAWIRE_finish(&frame, out, sizeof(out)) == 0U);
+}
+
+/* [TA_test_wire.c] END OF FILE */
@@ -0,0 +1,809 @@
+/**
+* \file <ta_convert.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Host converter of Timing Analyzer trace captures into viewer formats
+*
+* Reads trace events from a UART capture, either binary frames of TATRACE_sendAll (TAWire.h) or
+* text lines of TATRACE_printAll, also mixed with other output, and writes any of:
+*
+*   --json   Chrome Trace Event JSON (chrome://tracing, ui.perfetto.dev): one track per exception
+*            context, every start/resume .. pause/stop interval is a slice, nested by time
+*   --vcd    Value change dump (GTKWave): one digital signal per analyzer, high while it runs,
+*            like the pins on an external logic analyzer
+*   --csv    Summary per analyzer: runs, pauses, min/max/mean/total run time without pauses
+*
+*   ta_convert [-f MHz] [--json out.json] [--vcd out.vcd] [--csv out.csv] [capture]
+*
+* The capture is read once as a stream and only a fixed state per analyzer id is kept, so the
+* memory does not grow with the capture (overnight captures of several GB). Times start at 0 with
+* the first event.
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "TAWire.h"
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+#define CONVERT_DEFAULT_MHZ         (24.0)
+#define CONVERT_MAX_FRAME           (1024U)
+#define CONVERT_MAX_IDS             (256U)
+#define CONVERT_LINE_SIZE           (256U)
+#define CONVERT_CHUNK_SIZE          (65536U)
+#define CONVERT_COPY_SIZE           (65536U)
+#define CONVERT_FIRST_IRQ           (16U)           // Exception number of IRQ 0
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+typedef enum {
+    CONVERT_IDLE,
+    CONVERT_RUNNING,
+    CONVERT_PAUSED
+} CONVERT_State_t;
+
+/* Everything kept per analyzer id, the memory of the converter does not depend on the capture length */
+typedef struct {
+    char name[TAWIRE_NAME_MAX + 1U];
+    CONVERT_State_t state;
+    int seen;                       // Any event, gets a VCD signal and a CSV line
+    uint8_t ctx;                    // Context of the last start
+    uint64_t since;                 // Start/resume time of the running interval
+    uint64_t run;                   // Running time of the current run so far
+    unsigned long long runs;
+    unsigned long long pauses;
+    uint64_t total;
+    uint64_t min;
+    uint64_t max;
+    uint64_t first;                 // First start
+    uint64_t last;                  // Last stop
+} CONVERT_Analyzer_t;
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+static CONVERT_Analyzer_t convert_analyzers[CONVERT_MAX_IDS];
+static double convert_mhz = CONVERT_DEFAULT_MHZ;
+
+static FILE *convert_json = NULL;
+static FILE *convert_vcd = NULL;            // Value changes, the header follows at the end   (N1)
+static FILE *convert_vcd_out = NULL;
+static FILE *convert_csv = NULL;
+static int convert_json_first = 1;
+static int convert_contexts[CONVERT_MAX_IDS];  // Track announced in the JSON
+static uint64_t convert_vcd_time = 0ULL;    // The header ends at #0
+
+static uint64_t convert_time = 0ULL;        // Absolute cycles of the last event
+static uint32_t convert_last_raw = 0UL;     // Its 32 bit counter value
+static int convert_has_time = 0;
+static uint64_t convert_origin = 0ULL;      // Time of the first event, shown as 0
+
+static unsigned long long convert_events = 0ULL;
+static unsigned long long convert_unmatched = 0ULL;
+static unsigned long long convert_frames = 0ULL;
+static unsigned long long convert_bad_frames = 0ULL;
+static unsigned long convert_dropped = 0UL;
+
+/*****************************************************************************/
+/* Function implementation                                                   */
+/*****************************************************************************/
+
+static const char *CONVERT__name(uint8_t const id)
+{
+    static char unknown[16];
+
+    if (convert_analyzers[id].name[0] != '\0')
+    {
+        return convert_analyzers[id].name;
+    }
+    snprintf(unknown, sizeof(unknown), "#%u", id);
+    return unknown;
+}
+
+static double CONVERT__us(uint64_t const cycles)
+{
+    return (double)cycles / convert_mhz;
+}
+
+/**
+ * Func to turn an absolute 32 bit counter value into the absolute time, assuming less than one
+ * counter wrap since the previous one (179 s at 24 MHz).
+ * \param uint32_t const raw        : [IN] absolute 32 bit counter value
+ * \return None
+*/
+static void CONVERT__syncTime(uint32_t const raw)
+{
+    if (convert_has_time == 0)
+    {
+        convert_time   = raw;
+        convert_origin = raw;
+    }
+    else
+    {
+        convert_time += (uint32_t)(raw - convert_last_raw);
+    }
+    convert_last_raw = raw;
+    convert_has_time = 1;
+}
+
+/**
+ * Func to write a string as JSON string contents.
+ * \param FILE *out                 : [IN] stream
+ * \param const char *s             : [IN] string
+ * \return None
+*/
+static void CONVERT__jsonString(FILE *out, const char *s)
+{
+    for (; *s != '\0'; s++)
+    {
+        if ((*s == '"') || (*s == '\\'))
+        {
+            fprintf(out, "\\%c", *s);
+        }
+        else if ((unsigned char)*s < 0x20U)
+        {
+            fprintf(out, "\\u%04x", (unsigned int)(unsigned char)*s);
+        }
+        else
+        {
+            fputc(*s, out);
+        }
+    }
+}
+
+static void CONVERT__jsonSeparator(void)
+{
+    fputs((convert_json_first != 0) ? "\n" : ",\n", convert_json);
+    convert_json_first = 0;
+}
+
+/**
+ * Func to name the track of an exception context the first time it is used.
+ * \param uint8_t const ctx         : [IN] exception number, 0 = thread mode
+ * \return None
+*/
+static void CONVERT__jsonContext(uint8_t const ctx)
+{
+    char name[32];
+
+    if (convert_contexts[ctx] != 0)
+    {
+        return;
+    }
+    convert_contexts[ctx] = 1;
+
+    if (ctx == 0U)
+    {
+        snprintf(name, sizeof(name), "Thread mode");
+    }
+    else if (ctx < CONVERT_FIRST_IRQ)
+    {
+        static const char *const exceptions[CONVERT_FIRST_IRQ] = {
+            "", "Reset", "NMI", "HardFault", "MemManage", "BusFault", "UsageFault", "", "", "", "",
+            "SVCall", "DebugMon", "", "PendSV", "SysTick" };
+
+        snprintf(name, sizeof(name), "Exception %u %s", ctx, exceptions[ctx]);
+    }
+    else
+    {
+        snprintf(name, sizeof(name), "IRQ %u", ctx - CONVERT_FIRST_IRQ);
+    }
+
+    // Thread mode on top, then by exception number
+    CONVERT__jsonSeparator();
+    fprintf(convert_json, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}", ctx, name);
+    CONVERT__jsonSeparator();
+    fprintf(convert_json, "{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"sort_index\":%u}}", ctx, ctx);
+}
+
+/**
+ * Func to write one finished interval as complete event (ph X). Written at its end, the viewers sort by ts.
+ * \param uint8_t const id          : [IN] analyzer
+ * \param uint64_t const end        : [IN] pause or stop time
+ * \return None
+*/
+static void CONVERT__jsonSlice(uint8_t const id, uint64_t const end)
+{
+    CONVERT_Analyzer_t const *const me = &convert_analyzers[id];
+
+    if (convert_json == NULL)
+    {
+        return;
+    }
+    CONVERT__jsonContext(me->ctx);
+    CONVERT__jsonSeparator();
+    fputs("{\"name\":\"", convert_json);
+    CONVERT__jsonString(convert_json, CONVERT__name(id));
+    fprintf(convert_json, "\",\"cat\":\"ta\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{\"id\":%u}}",
+            CONVERT__us(me->since - convert_origin), CONVERT__us(end - me->since), me->ctx, id);
+}
+
+/**
+ * Func to write the level of an analyzer signal. VCD times only grow, so an event with an older
+ * timestamp than the previous one is written at the previous time.   (N2)
+ * \param uint8_t const id          : [IN] analyzer
+ * \param int const level           : [IN] 1 running, 0 not
+ * \return None
+*/
+static void CONVERT__vcdChange(uint8_t const id, int const level)
+{
+    uint64_t ns;
+
+    if (convert_vcd == NULL)
+    {
+        return;
+    }
+    ns = (uint64_t)((double)(convert_time - convert_origin) * 1000.0 / convert_mhz + 0.5);
+    if (ns > convert_vcd_time)
+    {
+        fprintf(convert_vcd, "#%llu\n", (unsigned long long)ns);
+        convert_vcd_time = ns;
+    }
+    fprintf(convert_vcd, "%d!%02x\n", level, id);
+}
+
+/**
+ * Func to run one event through the state of its analyzer and write the outputs.
+ * Events which do not fit the state (lost events, capture started in the middle) are counted and skipped.
+ * \param uint8_t const id          : [IN] analyzer
+ * \param uint8_t const type        : [IN] TA_TraceType_t
+ * \param uint8_t const ctx         : [IN] exception number of the caller
+ * \return None, the time is convert_time
+*/
+static void CONVERT__event(uint8_t const id, uint8_t const type, uint8_t const ctx)
+{
+    CONVERT_Analyzer_t *const me = &convert_analyzers[id];
+    uint64_t const now = convert_time;
+
+    convert_events++;
+    me->seen = 1;
+
+    switch (type)
+    {
+    case TATRACE_EVT_START:
+        if (me->state != CONVERT_IDLE)
+        {
+            convert_unmatched++;
+        }
+        if (me->runs == 0ULL)
+        {
+            me->first = now;
+        }
+        me->state = CONVERT_RUNNING;
+        me->ctx   = ctx;
+        me->since = now;
+        me->run   = 0ULL;
+        CONVERT__vcdChange(id, 1);
+        break;
+
+    case TATRACE_EVT_RESUME:
+        if (me->state != CONVERT_PAUSED)
+        {
+            convert_unmatched++;
+            break;
+        }
+        me->state = CONVERT_RUNNING;
+        me->since = now;
+        CONVERT__vcdChange(id, 1);
+        break;
+
+    case TATRACE_EVT_PAUSE:
+    case TATRACE_EVT_STOP:
+        if (me->state == CONVERT_IDLE)
+        {
+            convert_unmatched++;
+            break;
+        }
+        if (me->state == CONVERT_RUNNING)
+        {
+            me->run += now - me->since;
+            CONVERT__jsonSlice(id, now);
+            CONVERT__vcdChange(id, 0);
+        }
+        if (type == TATRACE_EVT_PAUSE)
+        {
+            me->pauses += (me->state == CONVERT_RUNNING) ? 1ULL : 0ULL;
+            me->state = CONVERT_PAUSED;
+            break;
+        }
+        me->min    = ((me->runs == 0ULL) || (me->run < me->min)) ? me->run : me->min;
+        me->max    = (me->run > me->max) ? me->run : me->max;
+        me->total += me->run;
+        me->last   = now;
+        me->runs++;
+        me->state  = CONVERT_IDLE;
+        break;
+
+    case TATRACE_EVT_PIN_HIGH:
+    case TATRACE_EVT_PIN_LOW:
+        break;              // Pin edges are for ta_correlate, the runs come from start .. stop
+
+    case TATRACE_EVT_CREATE:
+        // New analyzer behind the id, a run the deleted one left open ends here unmatched
+        if (me->state != CONVERT_IDLE)
+        {
+            convert_unmatched++;
+            me->state = CONVERT_IDLE;
+        }
+        break;
+
+    default:
+        convert_unmatched++;
+        break;
+    }
+}
+
+/**
+ * Func to note the dropped events counter of the target, an increase is marked in the JSON.
+ * \param unsigned long const dropped   : [IN] events lost on the target so far
+ * \return None
+*/
+static void CONVERT__dropped(unsigned long const dropped)
+{
+    if (dropped <= convert_dropped)
+    {
+        return;
+    }
+    if ((convert_json != NULL) && (convert_has_time != 0))
+    {
+        CONVERT__jsonSeparator();
+        fprintf(convert_json, "{\"name\":\"%lu events dropped\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f,\"pid\":1,\"tid\":0}",
+                dropped - convert_dropped, CONVERT__us(convert_time - convert_origin));
+    }
+    convert_dropped = dropped;
+}
+
+/**
+ * Func to give a name of a text line an id: the binary id with this name, else the lowest free one.
+ * \param const char *const name    : [IN] analyzer name
+ * \return id
+*/
+static uint8_t CONVERT__idOf(const char *const name)
+{
+    unsigned int free_id = CONVERT_MAX_IDS;
+
+    for (unsigned int id = 0U; id < CONVERT_MAX_IDS; id++)
+    {
+        if (strcmp(convert_analyzers[id].name, name) == 0)
+        {
+            return (uint8_t)id;
+        }
+        if ((free_id == CONVERT_MAX_IDS) && (convert_analyzers[id].name[0] == '\0') && (convert_analyzers[id].seen == 0))
+        {
+            free_id = id;
+        }
+    }
+    if (free_id == CONVERT_MAX_IDS)
+    {
+        free_id = CONVERT_MAX_IDS - 1U;     // More than 256 names, share the last id
+    }
+    snprintf(convert_analyzers[free_id].name, sizeof(convert_analyzers[free_id].name), "%s", name);
+    return (uint8_t)free_id;
+}
+
+/**
+ * Func to read one text line of TATRACE_printAll, other lines are skipped.
+ * \param char *const line          : [IN] line without line end
+ * \return None
+*/
+static void CONVERT__line(char *const line)
+{
+    static const char *const types[TATRACE_EVT_COUNT] = { "START", "PAUSE", "RESUME", "STOP", "PIN_HI", "PIN_LO", "CREATE" };
+    char const *p = strstr(line, "Trace: ");
+    unsigned long raw, dropped;
+    unsigned int ctx;
+    char type[16];
+    int name_pos = 0;
+
+    if (p == NULL)
+    {
+        return;
+    }
+    line[strcspn(line, "\r")] = '\0';
+    if ((sscanf(p, "Trace: %lu | %15s | ctx %u | %n", &raw, type, &ctx, &name_pos) == 3) && (name_pos != 0) && (ctx < CONVERT_MAX_IDS))
+    {
+        for (uint8_t t = 0U; t < TATRACE_EVT_COUNT; t++)
+        {
+            if (strcmp(type, types[t]) == 0)
+            {
+                CONVERT__syncTime((uint32_t)raw);
+                CONVERT__event(CONVERT__idOf(&p[name_pos]), t, (uint8_t)ctx);
+                break;
+            }
+        }
+    }
+    else if (sscanf(p, "Trace: %lu events dropped", &dropped) == 1)
+    {
+        CONVERT__dropped(dropped);
+    }
+}
+
+/**
+ * Func to read the records of one checked frame, statistics records are skipped.
+ * \param uint8_t const *const data : [IN] records
+ * \param uint16_t const length     : [IN] number of bytes
+ * \return 0 when all records were understood
+*/
+static int CONVERT__records(uint8_t const *const data, uint16_t const length)
+{
+    TA_WireReader_t reader;
+    TA_WireRecord_t record;
+    RC_t res;
+
+    (void)TAWIRE_readBegin(&reader, data, length);
+    while ((res = TAWIRE_readNext(&reader, &record)) == RC_SUCCESS)
+    {
+        if (record.tag == TAWIRE_TAG_EVENT)
+        {
+            if (record.absolute == TRUE)
+            {
+                CONVERT__syncTime(record.timestamp);
+            }
+            else
+            {
+                convert_time     += record.timestamp;
+                convert_last_raw += record.timestamp;
+            }
+            CONVERT__event(record.id, record.type, record.ctx);
+        }
+        else if (record.tag == TAWIRE_TAG_NAME)
+        {
+            memcpy(convert_analyzers[record.id].name, record.name, sizeof(record.name));
+        }
+        else if (record.tag == TAWIRE_TAG_DROPPED)
+        {
+            CONVERT__dropped(record.dropped);
+        }
+    }
+    return (res == RC_ERROR_BUFFER_EMTPY) ? 0 : -1;
+}
+
+/**
+ * Func to check whether a block between two delimiters is text output only.
+ * \param uint8_t const *const data : [IN] bytes
+ * \param uint16_t const length     : [IN] number of bytes
+ * \return 1 for printable ASCII only (incl. CR, LF, TAB)
+*/
+static int CONVERT__isText(uint8_t const *const data, uint16_t const length)
+{
+    for (uint16_t i = 0U; i < length; i++)
+    {
+        if (((data[i] < 0x20U) || (data[i] > 0x7EU)) && (data[i] != '\r') && (data[i] != '\n') && (data[i] != '\t'))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Func to decode the block before a delimiter. Text output in front of a frame has no delimiter of
+ * its own, so the frame is searched at every line start (the CRC rejects the wrong ones).
+ * \param uint8_t const *const block    : [IN] bytes
+ * \param uint16_t const length         : [IN] number of bytes
+ * \return None
+*/
+static void CONVERT__block(uint8_t const *const block, uint16_t const length)
+{
+    static uint8_t copy[CONVERT_MAX_FRAME];
+    uint16_t start = 0U;
+
+    while (start < length)
+    {
+        uint16_t records;
+
+        memcpy(copy, &block[start], length - start);
+        if (TAWIRE_decode(copy, length - start, &records) == RC_SUCCESS)
+        {
+            convert_frames++;
+            if (CONVERT__records(copy, records) != 0)
+            {
+                convert_bad_frames++;
+            }
+            return;
+        }
+        while ((start < length) && (block[start] != '\n'))
+        {
+            start++;
+        }
+        start++;
+    }
+
+    // Text only, already handled line by line
+    if (CONVERT__isText(block, length) == 0)
+    {
+        convert_frames++;
+        convert_bad_frames++;
+    }
+}
+
+/**
+ * Func to write the VCD header with one signal per analyzer, then the buffered value changes.
+ * \param None
+ * \return 0 when success
+*/
+static int CONVERT__vcdFinish(void)
+{
+    static char copy[CONVERT_COPY_SIZE];
+    size_t n;
+
+    fprintf(convert_vcd_out, "$version ta_convert $end\n$timescale 1ns $end\n$scope module ta $end\n");
+    for (unsigned int id = 0U; id < CONVERT_MAX_IDS; id++)
+    {
+        if (convert_analyzers[id].seen != 0)
+        {
+            fprintf(convert_vcd_out, "$var wire 1 !%02x ", id);
+
+            // VCD identifiers have no blanks
+            for (char const *c = CONVERT__name((uint8_t)id); *c != '\0'; c++)
+            {
+                fputc(((*c <= ' ') || (*c > '~')) ? '_' : *c, convert_vcd_out);
+            }
+            fputs(" $end\n", convert_vcd_out);
+        }
+    }
+    fprintf(convert_vcd_out, "$upscope $end\n$enddefinitions $end\n#0\n$dumpvars\n");
+    for (unsigned int id = 0U; id < CONVERT_MAX_IDS; id++)
+    {
+        if (convert_analyzers[id].seen != 0)
+        {
+            fprintf(convert_vcd_out, "0!%02x\n", id);
+        }
+    }
+    fprintf(convert_vcd_out, "$end\n");
+
+    rewind(convert_vcd);
+    while ((n = fread(copy, 1U, sizeof(copy), convert_vcd)) != 0U)
+    {
+        if (fwrite(copy, 1U, n, convert_vcd_out) != n)
+        {
+            return -1;
+        }
+    }
+    return ferror(convert_vcd);
+}
+
+static void CONVERT__csvFinish(void)
+{
+    fprintf(convert_csv, "id,name,ctx,runs,pauses,total_cycles,min_cycles,max_cycles,mean_cycles,total_us,min_us,max_us,mean_us,first_us,last_us\n");
+    for (unsigned int id = 0U; id < CONVERT_MAX_IDS; id++)
+    {
+        CONVERT_Analyzer_t const *const me = &convert_analyzers[id];
+        uint64_t mean = (me->runs != 0ULL) ? (me->total / me->runs) : 0ULL;
+
+        if (me->seen == 0)
+        {
+            continue;
+        }
+        fprintf(convert_csv, "%u,\"", id);
+        for (char const *c = CONVERT__name((uint8_t)id); *c != '\0'; c++)
+        {
+            if (*c == '"')
+            {
+                fputc('"', convert_csv);        // Quotes are doubled in CSV
+            }
+            fputc(*c, convert_csv);
+        }
+        fprintf(convert_csv, "\",%u,%llu,%llu,%llu,%llu,%llu,%llu,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n",
+                me->ctx, me->runs, me->pauses,
+                (unsigned long long)me->total, (unsigned long long)me->min, (unsigned long long)me->max, (unsigned long long)mean,
+                CONVERT__us(me->total), CONVERT__us(me->min), CONVERT__us(me->max), CONVERT__us(mean),
+                (me->runs != 0ULL) ? CONVERT__us(me->first - convert_origin) : 0.0,
+                (me->runs != 0ULL) ? CONVERT__us(me->last - convert_origin) : 0.0);
+    }
+}
+
+/**
+ * Func to open an output file, "-" is stdout.
+ * \param const char *const path    : [IN] file name
+ * \return stream, NULL on error
+*/
+static FILE *CONVERT__open(const char *const path)
+{
+    FILE *out = (strcmp(path, "-") == 0) ? stdout : fopen(path, "w");
+
+    if (out == NULL)
+    {
+        perror(path);
+    }
+    return out;
+}
+
+static void CONVERT__usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-f MHz] [--json out.json] [--vcd out.vcd] [--csv out.csv] [capture]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    static uint8_t chunk[CONVERT_CHUNK_SIZE];
+    static uint8_t frame[CONVERT_MAX_FRAME];
+    char line[CONVERT_LINE_SIZE];
+    const char *path = NULL;
+    FILE *in = stdin;
+    uint16_t length = 0U;
+    size_t line_length = 0U;
+    int overflow = 0;
+    int result = EXIT_SUCCESS;
+    size_t n;
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-f") == 0) && (i + 1 < argc))
+        {
+            convert_mhz = strtod(argv[++i], NULL);
+        }
+        else if ((strcmp(argv[i], "--json") == 0) && (i + 1 < argc) && (convert_json == NULL))
+        {
+            if ((convert_json = CONVERT__open(argv[++i])) == NULL)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--vcd") == 0) && (i + 1 < argc) && (convert_vcd_out == NULL))
+        {
+            if ((convert_vcd_out = CONVERT__open(argv[++i])) == NULL)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--csv") == 0) && (i + 1 < argc) && (convert_csv == NULL))
+        {
+            if ((convert_csv = CONVERT__open(argv[++i])) == NULL)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((argv[i][0] != '-') && (path == NULL))
+        {
+            path = argv[i];
+        }
+        else
+        {
+            CONVERT__usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if ((convert_mhz <= 0.0) || ((convert_json == NULL) && (convert_vcd_out == NULL) && (convert_csv == NULL)))
+    {
+        CONVERT__usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (path != NULL)
+    {
+        in = fopen(path, "rb");
+        if (in == NULL)
+        {
+            perror(path);
+            return EXIT_FAILURE;
+        }
+    }
+    if (convert_vcd_out != NULL)
+    {
+        convert_vcd = tmpfile();
+        if (convert_vcd == NULL)
+        {
+            perror("tmpfile");
+            return EXIT_FAILURE;
+        }
+    }
+    if (convert_json != NULL)
+    {
+        fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", convert_json);
+    }
+
+    // Every byte goes to the line reader and to the frame reader, whichever understands it
+    while ((n = fread(chunk, 1U, sizeof(chunk), in)) != 0U)
+    {
+        for (size_t k = 0U; k < n; k++)
+        {
+            uint8_t c = chunk[k];
+
+            if ((c == '\n') || (c == TAWIRE_DELIMITER))
+            {
+                line[line_length] = '\0';
+                CONVERT__line(line);
+                line_length = 0U;
+            }
+            else if (line_length < (sizeof(line) - 1U))
+            {
+                line[line_length++] = (char)c;
+            }
+
+            if (c != TAWIRE_DELIMITER)
+            {
+                if (length < CONVERT_MAX_FRAME)
+                {
+                    frame[length++] = c;
+                }
+                else
+                {
+                    overflow = 1;       // Long text, only its lines are used
+                }
+                continue;
+            }
+            if ((length != 0U) && (overflow == 0))
+            {
+                CONVERT__block(frame, length);
+            }
+            length   = 0U;
+            overflow = 0;
+        }
+    }
+    line[line_length] = '\0';
+    CONVERT__line(line);
+
+    if (ferror(in) != 0)
+    {
+        perror((path != NULL) ? path : "stdin");
+        result = EXIT_FAILURE;
+    }
+    if (in != stdin)
+    {
+        (void)fclose(in);
+    }
+
+    if (convert_json != NULL)
+    {
+        fputs("\n]}\n", convert_json);
+        if ((fflush(convert_json) != 0) || ((convert_json != stdout) && (fclose(convert_json) != 0)))
+        {
+            result = EXIT_FAILURE;
+        }
+    }
+    if (convert_vcd_out != NULL)
+    {
+        if ((CONVERT__vcdFinish() != 0) || (fflush(convert_vcd_out) != 0) ||
+            ((convert_vcd_out != stdout) && (fclose(convert_vcd_out) != 0)))
+        {
+            result = EXIT_FAILURE;
+        }
+        (void)fclose(convert_vcd);
+    }
+    if (convert_csv != NULL)
+    {
+        CONVERT__csvFinish();
+        if ((fflush(convert_csv) != 0) || ((convert_csv != stdout) && (fclose(convert_csv) != 0)))
+        {
+            result = EXIT_FAILURE;
+        }
+    }
+
+    fprintf(stderr, "%llu events, %llu unmatched, %lu dropped on target, %llu frames, %llu corrupted\n",
+            convert_events, convert_unmatched, convert_dropped, convert_frames, convert_bad_frames);
+    return ((result == EXIT_SUCCESS) && (convert_bad_frames == 0ULL)) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* NOTE
+ *
+ * 1. A VCD file declares all signals before the first value change, but which analyzers occur is
+ * only known at the end of the capture. The value changes are streamed into a temporary file and
+ * the header is written in front of them at the end, so the input is still read only once (also
+ * from a pipe) and the memory stays constant; the disk holds one copy of the changes.
+ *
+ * 2. Timestamps are taken inside the reservation loop of TATRACE_record, so the ring is in time
+ * order; the text output of TATRACE_printAll has only 32 bit timestamps and relies on less than
+ * one counter wrap between two lines. Should an older time still appear (e.g. two captures
+ * concatenated), it is written at the current VCD time instead of breaking the file.
+ */
+
+/* [ta_convert.c] END OF FILE */
@@ -0,0 +1,789 @@
+/**
+* \file <ta_correlate.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Host correlation of internal pin edge timestamps with a logic analyzer capture
+*
+* With TA_CFG_PIN_EDGES the pin modes record a PIN_HI/PIN_LO trace event with the DWT timestamp of
+* every pin edge. This tool reads these events and the capture of the same pins from a logic
+* analyzer (CSV export of sigrok/PulseView, Saleae, DSView, ...), pairs the edges of both and fits
+* external time = offset + scale * internal time. It reports per pin:
+*
+*   - the clock deviation of the CPU against the logic analyzer in ppm
+*   - the distribution of the edge timing residuals (jitter of the pin toggle latency), separately
+*     for rising and falling edges, and the latency difference between them
+*   - the difference of every high pulse width between capture and internal timestamps
+*
+*   ta_decode --csv capture.bin > events.csv
+*   ta_correlate [-f MHz] [-r Hz] [-t us] [-p pairs.csv] -c D0="adc isr" [-c D1=...] events.csv la.csv
+*
+* The events file is the output of ta_decode --csv or the text of TATRACE_printAll. The first
+* line with letters in the logic analyzer CSV names the columns; a column whose name starts with
+* "Time" is the time ("[s]", "[ms]", "[us]" or "[ns]", seconds without unit), without it the rows
+* are samples at the rate of -r or of a "; Samplerate: 24 MHz" comment line.
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+#define CORR_DEFAULT_MHZ            (24.0)
+#define CORR_DEFAULT_TOLERANCE_US   (2.0)
+#define CORR_MAX_CHANNELS           (8U)
+#define CORR_NAME_SIZE              (64U)
+#define CORR_LINE_SIZE              (4096U)
+#define CORR_MAX_COLUMNS            (64U)
+#define CORR_WINDOW                 (32U)           // Edges compared to find the first pair
+#define CORR_SEARCH                 (4096U)         // Edges searched for the first pair on one side ...
+#define CORR_SEARCH_OTHER           (64U)           // ... while the other side starts within these
+#define CORR_MIN_SPAN_NS            (1.0e8)         // Pairs span before the clock ratio is estimated (100 ms)
+#define CORR_NS_PER_S               (1.0e9)
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+typedef struct {
+    double t;                       // ns, internal: DWT cycles at the nominal clock, external: capture time
+    int level;                      // Level after the edge
+} CORR_Edge_t;
+
+typedef struct {
+    double internal;
+    double external;
+    int level;
+    size_t i;                       // Index of the internal edge
+    size_t j;                       // Index of the external edge
+} CORR_Pair_t;
+
+typedef struct {
+    char column[CORR_NAME_SIZE];    // Column of the logic analyzer CSV
+    char analyzer[CORR_NAME_SIZE];  // Analyzer name of the events
+    int index;                      // Column index, -1 until the header was read
+    CORR_Edge_t *internal;
+    size_t internal_count;
+    size_t internal_size;
+    CORR_Edge_t *external;
+    size_t external_count;
+    size_t external_size;
+    int level;                      // Last external level, -1 before the first row
+} CORR_Channel_t;
+
+typedef struct {
+    size_t count;
+    double mean;
+    double stddev;
+    double min;
+    double p50;
+    double p90;
+    double p99;
+    double max;
+} CORR_Stats_t;
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+static CORR_Channel_t corr_channels[CORR_MAX_CHANNELS];
+static unsigned int corr_channel_count = 0U;
+static double corr_mhz = CORR_DEFAULT_MHZ;
+static double corr_tolerance_ns = CORR_DEFAULT_TOLERANCE_US * 1000.0;
+static double corr_samplerate = 0.0;
+static FILE *corr_pairs_out = NULL;
+
+/*****************************************************************************/
+/* Function implementation                                                   */
+/*****************************************************************************/
+
+static void CORR__push(CORR_Edge_t **edges, size_t *const count, size_t *const size, double const t, int const level)
+{
+    if (*count == *size)
+    {
+        *size  = (*size != 0U) ? (*size * 2U) : 1024U;
+        *edges = realloc(*edges, *size * sizeof(CORR_Edge_t));
+        if (*edges == NULL)
+        {
+            fprintf(stderr, "out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    (*edges)[*count].t     = t;
+    (*edges)[*count].level = level;
+    (*count)++;
+}
+
+static char *CORR__trim(char *s)
+{
+    char *end;
+
+    while ((*s == ' ') || (*s == '"') || (*s == '\t'))
+    {
+        s++;
+    }
+    end = s + strlen(s);
+    while ((end > s) && ((end[-1] == ' ') || (end[-1] == '"') || (end[-1] == '\t') || (end[-1] == '\r') || (end[-1] == '\n')))
+    {
+        end--;
+    }
+    *end = '\0';
+    return s;
+}
+
+/**
+ * Func to add one internal edge to the channel of its analyzer.
+ * \param const char *const name    : [IN] analyzer name
+ * \param const char *const type    : [IN] event type, only PIN_HI and PIN_LO are edges
+ * \param double const ns           : [IN] time
+ * \return None
+*/
+static void CORR__internalEdge(const char *const name, const char *const type, double const ns)
+{
+    int level;
+
+    if (strcmp(type, "PIN_HI") == 0)
+    {
+        level = 1;
+    }
+    else if (strcmp(type, "PIN_LO") == 0)
+    {
+        level = 0;
+    }
+    else
+    {
+        return;
+    }
+    for (unsigned int c = 0U; c < corr_channel_count; c++)
+    {
+        CORR_Channel_t *const ch = &corr_channels[c];
+
+        if (strcmp(ch->analyzer, name) == 0)
+        {
+            CORR__push(&ch->internal, &ch->internal_count, &ch->internal_size, ns, level);
+        }
+    }
+}
+
+/**
+ * Func to read the pin edge events: "event,cycles,us,TYPE,\"name\",ctx" lines of ta_decode --csv or
+ * "Trace: timestamp | TYPE | ctx n | name" lines of TATRACE_printAll (32 bit timestamps, unwrapped).
+ * \param FILE *in                  : [IN] events
+ * \return None
+*/
+static void CORR__readEvents(FILE *in)
+{
+    char line[CORR_LINE_SIZE];
+    uint64_t time = 0ULL;
+    uint32_t last_raw = 0UL;
+    int has_time = 0;
+
+    while (fgets(line, sizeof(line), in) != NULL)
+    {
+        unsigned long long cycles;
+        unsigned long raw;
+        unsigned int ctx;
+        char type[16];
+        int pos = 0;
+        char *p;
+
+        if ((sscanf(line, "event,%llu,%*[^,],%15[^,],%n", &cycles, type, &pos) == 2) && (pos != 0))
+        {
+            // The name is a quoted CSV field, the context is behind the last comma
+            char *name = &line[pos];
+            char *comma = strrchr(name, ',');
+
+            if (comma != NULL)
+            {
+                *comma = '\0';
+            }
+            name = CORR__trim(name);
+            if (name[0] == '"')
+            {
+                char *out = name;
+
+                for (char const *in = &name[1]; *in != '\0'; in++)
+                {
+                    if ((*in == '"') && (in[1] == '"'))
+                    {
+                        in++;                   // Doubled quote inside the field
+                    }
+                    else if (*in == '"')
+                    {
+                        break;
+                    }
+                    *out++ = *in;
+                }
+                *out = '\0';
+            }
+            CORR__internalEdge(name, type, (double)cycles * 1000.0 / corr_mhz);
+            continue;
+        }
+
+        p = strstr(line, "Trace: ");
+        if ((p != NULL) && (sscanf(p, "Trace: %lu | %15s | ctx %u | %n", &raw, type, &ctx, &pos) == 3) && (pos != 0))
+        {
+            time     = (has_time != 0) ? (time + (uint32_t)((uint32_t)raw - last_raw)) : (uint64_t)raw;
+            last_raw = (uint32_t)raw;
+            has_time = 1;
+            CORR__internalEdge(CORR__trim(&p[pos]), type, (double)time * 1000.0 / corr_mhz);
+        }
+    }
+}
+
+/**
+ * Func to scale a time column unit like "Time [us]" to ns.
+ * \param const char *const header  : [IN] column name
+ * \return ns per unit
+*/
+static double CORR__timeUnit(const char *const header)
+{
+    const char *unit = strchr(header, '[');
+
+    if (unit == NULL)
+    {
+        return CORR_NS_PER_S;
+    }
+    unit++;
+    if (strncmp(unit, "ns", 2U) == 0)
+    {
+        return 1.0;
+    }
+    if ((strncmp(unit, "us", 2U) == 0) || (strncmp(unit, "\xC2\xB5s", 3U) == 0))
+    {
+        return 1.0e3;
+    }
+    if (strncmp(unit, "ms", 2U) == 0)
+    {
+        return 1.0e6;
+    }
+    return CORR_NS_PER_S;
+}
+
+/**
+ * Func to read the logic analyzer CSV, only the level changes of the selected columns are kept.
+ * \param FILE *in                  : [IN] capture
+ * \return 0 when success
+*/
+static int CORR__readCapture(FILE *in)
+{
+    char line[CORR_LINE_SIZE];
+    int time_column = -1;
+    double time_unit = CORR_NS_PER_S;
+    int has_header = 0;
+    unsigned long long row = 0ULL;
+
+    while (fgets(line, sizeof(line), in) != NULL)
+    {
+        char *fields[CORR_MAX_COLUMNS];
+        unsigned int count = 0U;
+        char *save = NULL;
+        double t;
+
+        if ((line[0] == ';') || (line[0] == '#'))
+        {
+            double rate;
+            char unit[8];
+
+            // sigrok writes e.g. "; Samplerate: 24 MHz"
+            if ((corr_samplerate <= 0.0) && (strstr(line, "amplerate") != NULL) &&
+                (sscanf(strchr(line, ':') != NULL ? strchr(line, ':') + 1 : line, "%lf %7s", &rate, unit) == 2))
+            {
+                corr_samplerate = rate * ((unit[0] == 'G') ? 1.0e9 : (unit[0] == 'M') ? 1.0e6 : (unit[0] == 'k') ? 1.0e3 : 1.0);
+            }
+            continue;
+        }
+
+        for (char *field = strtok_r(line, ",", &save); (field != NULL) && (count < CORR_MAX_COLUMNS); field = strtok_r(NULL, ",", &save))
+        {
+            fields[count++] = CORR__trim(field);
+        }
+        if (count == 0U)
+        {
+            continue;
+        }
+
+        if (has_header == 0)
+        {
+            int letters = 0;
+
+            for (const char *c = line; *c != '\0'; c++)
+            {
+                letters |= isalpha((unsigned char)*c);
+            }
+            if (letters == 0)
+            {
+                fprintf(stderr, "capture: no header line with the column names\n");
+                return -1;
+            }
+            for (unsigned int k = 0U; k < count; k++)
+            {
+                if (strncasecmp(fields[k], "time", 4U) == 0)
+                {
+                    time_column = (int)k;
+                    time_unit   = CORR__timeUnit(fields[k]);
+                }
+                for (unsigned int c = 0U; c < corr_channel_count; c++)
+                {
+                    if (strcmp(fields[k], corr_channels[c].column) == 0)
+                    {
+                        corr_channels[c].index = (int)k;
+                    }
+                }
+            }
+            for (unsigned int c = 0U; c < corr_channel_count; c++)
+            {
+                if (corr_channels[c].index < 0)
+                {
+                    fprintf(stderr, "capture: no column %s\n", corr_channels[c].column);
+                    return -1;
+                }
+            }
+            if ((time_column < 0) && (corr_samplerate <= 0.0))
+            {
+                fprintf(stderr, "capture: no time column, give the sample rate with -r\n");
+                return -1;
+            }
+            has_header = 1;
+            continue;
+        }
+
+        t = (time_column >= 0) ? (strtod(fields[time_column], NULL) * time_unit) : ((double)row * CORR_NS_PER_S / corr_samplerate);
+        row++;
+
+        for (unsigned int c = 0U; c < corr_channel_count; c++)
+        {
+            CORR_Channel_t *const ch = &corr_channels[c];
+            int level;
+
+            if ((unsigned int)ch->index >= count)
+            {
+                continue;
+            }
+            level = (strtol(fields[ch->index], NULL, 0) != 0L) ? 1 : 0;
+            if ((ch->level >= 0) && (level != ch->level))
+            {
+                CORR__push(&ch->external, &ch->external_count, &ch->external_size, t, level);
+            }
+            ch->level = level;
+        }
+    }
+    return (has_header != 0) ? 0 : -1;
+}
+
+/**
+ * Func to find the first pair of edges: the start pair whose following CORR_WINDOW edge intervals
+ * match best, with one side starting within its first CORR_SEARCH_OTHER edges.
+ * \param CORR_Channel_t const *const ch : [IN] channel
+ * \param size_t *const i0          : [OUT] first internal edge
+ * \param size_t *const j0          : [OUT] first external edge
+ * \return 0 when found
+*/
+static int CORR__findStart(CORR_Channel_t const *const ch, size_t *const i0, size_t *const j0)
+{
+    CORR_Edge_t const *const in = ch->internal;
+    CORR_Edge_t const *const ex = ch->external;
+    size_t window = CORR_WINDOW;
+    double best = HUGE_VAL;
+
+    if ((ch->internal_count < 2U) || (ch->external_count < 2U))
+    {
+        return -1;
+    }
+    window = (window < ch->internal_count - 1U) ? window : (ch->internal_count - 1U);
+    window = (window < ch->external_count - 1U) ? window : (ch->external_count - 1U);
+
+    for (size_t i = 0U; (i + window < ch->internal_count) && (i < CORR_SEARCH); i++)
+    {
+        for (size_t j = 0U; (j + window < ch->external_count) && (j < CORR_SEARCH); j++)
+        {
+            double score = 0.0;
+
+            if (((i >= CORR_SEARCH_OTHER) && (j >= CORR_SEARCH_OTHER)) || (in[i].level != ex[j].level))
+            {
+                continue;
+            }
+            for (size_t k = 0U; (k < window) && (score < best); k++)
+            {
+                score += fabs((in[i + k + 1U].t - in[i + k].t) - (ex[j + k + 1U].t - ex[j + k].t));
+            }
+            if (score < best)
+            {
+                best = score;
+                *i0  = i;
+                *j0  = j;
+            }
+        }
+    }
+    return (best < HUGE_VAL) ? 0 : -1;
+}
+
+/**
+ * Func to pair the edges around the first pair. Every internal edge is expected at the time of the
+ * nearest pair plus its distance to it, scaled by the clock ratio seen so far; the external edge of
+ * the same level within the tolerance is its pair. Edges without pair were lost on one side.   (N1)
+ * \param CORR_Channel_t const *const ch : [IN] channel
+ * \param size_t const i0           : [IN] first internal edge
+ * \param size_t const j0           : [IN] first external edge
+ * \param size_t *const count       : [OUT] number of pairs
+ * \return pairs, to be freed by the caller
+*/
+static CORR_Pair_t *CORR__pair(CORR_Channel_t const *const ch, size_t const i0, size_t const j0, size_t *const count)
+{
+    CORR_Pair_t *pairs = malloc(ch->internal_count * sizeof(CORR_Pair_t));
+    CORR_Edge_t const *const in = ch->internal;
+    CORR_Edge_t const *const ex = ch->external;
+    double ratio = 1.0;
+    size_t used = 0U;
+    size_t j = j0;
+
+    if (pairs == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Edges before the first pair, walking back at the nominal clock ratio. They are stored downwards from i0 and moved to the front
+    for (size_t i = i0; (i > 0U) && (j > 0U); i--)
+    {
+        double expected = ((used == 0U) ? ex[j0].t : pairs[i0 - used].external) - (((used == 0U) ? in[i0].t : pairs[i0 - used].internal) - in[i - 1U].t);
+
+        while ((j > 0U) && (ex[j - 1U].t > (expected + corr_tolerance_ns)))
+        {
+            j--;
+        }
+        if ((j > 0U) && (ex[j - 1U].t >= (expected - corr_tolerance_ns)) && (ex[j - 1U].level == in[i - 1U].level))
+        {
+            used++;
+            j--;
+            pairs[i0 - used].internal = in[i - 1U].t;
+            pairs[i0 - used].external = ex[j].t;
+            pairs[i0 - used].level    = in[i - 1U].level;
+            pairs[i0 - used].i        = i - 1U;
+            pairs[i0 - used].j        = j;
+        }
+    }
+    memmove(&pairs[0], &pairs[i0 - used], used * sizeof(CORR_Pair_t));
+
+    j = j0;
+    for (size_t i = i0; (i < ch->internal_count) && (j < ch->external_count); i++)
+    {
+        double expected = (used == 0U) ? ex[j0].t : (pairs[used - 1U].external + ratio * (in[i].t - pairs[used - 1U].internal));
+
+        while ((j < ch->external_count) && (ex[j].t < (expected - corr_tolerance_ns)))
+        {
+            j++;
+        }
+        if ((j < ch->external_count) && (ex[j].t <= (expected + corr_tolerance_ns)) && (ex[j].level == in[i].level))
+        {
+            pairs[used].internal = in[i].t;
+            pairs[used].external = ex[j].t;
+            pairs[used].level    = in[i].level;
+            pairs[used].i        = i;
+            pairs[used].j        = j;
+            used++;
+            j++;
+
+            if ((in[i].t - pairs[0].internal) >= CORR_MIN_SPAN_NS)
+            {
+                ratio = (pairs[used - 1U].external - pairs[0].external) / (pairs[used - 1U].internal - pairs[0].internal);
+            }
+        }
+    }
+    *count = used;
+    return pairs;
+}
+
+static int CORR__compare(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * Func to calculate the distribution of values.
+ * \param double *const values      : [IN/OUT] values, sorted afterwards
+ * \param size_t const count        : [IN] number of values
+ * \return statistics, all 0 without values
+*/
+static CORR_Stats_t CORR__stats(double *const values, size_t const count)
+{
+    CORR_Stats_t stats = { 0 };
+    double sum = 0.0;
+    double square = 0.0;
+
+    if (count == 0U)
+    {
+        return stats;
+    }
+    for (size_t k = 0U; k < count; k++)
+    {
+        sum += values[k];
+    }
+    stats.count = count;
+    stats.mean  = sum / (double)count;
+    for (size_t k = 0U; k < count; k++)
+    {
+        square += (values[k] - stats.mean) * (values[k] - stats.mean);
+    }
+    stats.stddev = sqrt(square / (double)count);
+
+    qsort(values, count, sizeof(double), CORR__compare);
+    stats.min = values[0];
+    stats.p50 = values[(count - 1U) / 2U];
+    stats.p90 = values[((count - 1U) * 90U) / 100U];
+    stats.p99 = values[((count - 1U) * 99U) / 100U];
+    stats.max = values[count - 1U];
+    return stats;
+}
+
+static void CORR__printStats(const char *const label, CORR_Stats_t const *const s)
+{
+    printf("  %-24s %8zu %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f\n", label, s->count, s->mean, s->stddev,
+           s->min, s->p50, s->p90, s->p99, s->max);
+}
+
+/**
+ * Func to align and report one channel.
+ * \param CORR_Channel_t const *const ch : [IN] channel
+ * \return 0 when the edges could be paired
+*/
+static int CORR__report(CORR_Channel_t const *const ch)
+{
+    size_t i0 = 0U, j0 = 0U, count, rising = 0U, falling = 0U, widths = 0U;
+    double sxx = 0.0, sxy = 0.0, mx = 0.0, my = 0.0, scale, offset, worst = 0.0;
+    double *rise_values, *fall_values, *width_values;
+    CORR_Stats_t rise, fall, width;
+    CORR_Pair_t *pairs;
+
+    printf("%s <-> %s\n", ch->column, ch->analyzer);
+    if (CORR__findStart(ch, &i0, &j0) != 0)
+    {
+        printf("  too few edges: %zu internal, %zu in the capture\n\n", ch->internal_count, ch->external_count);
+        return -1;
+    }
+    pairs = CORR__pair(ch, i0, j0, &count);
+    if (count < 2U)
+    {
+        printf("  no matching edges within %.1f us\n\n", corr_tolerance_ns / 1000.0);
+        free(pairs);
+        return -1;
+    }
+
+    // Least squares line external = offset + scale * internal, relative to the first pair for precision
+    for (size_t k = 0U; k < count; k++)
+    {
+        mx += pairs[k].internal - pairs[0].internal;
+        my += pairs[k].external - pairs[0].external;
+    }
+    mx /= (double)count;
+    my /= (double)count;
+    for (size_t k = 0U; k < count; k++)
+    {
+        double dx = pairs[k].internal - pairs[0].internal - mx;
+
+        sxx += dx * dx;
+        sxy += dx * (pairs[k].external - pairs[0].external - my);
+    }
+    scale  = (sxx > 0.0) ? (sxy / sxx) : 1.0;
+    offset = my - scale * mx;
+
+    rise_values  = malloc(count * sizeof(double));
+    fall_values  = malloc(count * sizeof(double));
+    width_values = malloc(count * sizeof(double));
+    if ((rise_values == NULL) || (fall_values == NULL) || (width_values == NULL))
+    {
+        fprintf(stderr, "out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (size_t k = 0U; k < count; k++)
+    {
+        double fit = pairs[0].external + offset + scale * (pairs[k].internal - pairs[0].internal);
+        double residual = pairs[k].external - fit;
+
+        if (pairs[k].level != 0)
+        {
+            rise_values[rising++] = residual;
+        }
+        else
+        {
+            fall_values[falling++] = residual;
+        }
+        worst = (fabs(residual) > worst) ? fabs(residual) : worst;
+
+        // High pulse seen complete on both sides
+        if ((pairs[k].level == 0) && (k > 0U) && (pairs[k - 1U].level != 0) &&
+            (pairs[k - 1U].i + 1U == pairs[k].i) && (pairs[k - 1U].j + 1U == pairs[k].j))
+        {
+            width_values[widths++] = (pairs[k].external - pairs[k - 1U].external) - scale * (pairs[k].internal - pairs[k - 1U].internal);
+        }
+        if (corr_pairs_out != NULL)
+        {
+            fprintf(corr_pairs_out, "%s,%s,%.1f,%.1f,%.1f\n", ch->column, (pairs[k].level != 0) ? "rise" : "fall",
+                    pairs[k].internal, pairs[k].external, residual);
+        }
+    }
+
+    rise  = CORR__stats(rise_values, rising);
+    fall  = CORR__stats(fall_values, falling);
+    width = CORR__stats(width_values, widths);
+
+    printf("  edges: %zu internal, %zu in the capture, %zu paired\n", ch->internal_count, ch->external_count, count);
+    printf("  CPU clock against the logic analyzer: %+.2f ppm (at -f %.3f MHz)\n", (scale - 1.0) * 1.0e6, corr_mhz);
+    printf("\n  [ns]                        count      mean    stddev       min       p50       p90       p99       max\n");
+    CORR__printStats("rising edge residual", &rise);
+    CORR__printStats("falling edge residual", &fall);
+    CORR__printStats("high time ext - int", &width);
+    printf("\n  pin toggle latency rising - falling edge: %+.1f ns\n", rise.mean - fall.mean);
+    printf("  internal edge timestamps agree with the capture within %.1f ns (worst pair)", worst);
+    if (corr_samplerate > 0.0)
+    {
+        printf(", sample period %.1f ns", CORR_NS_PER_S / corr_samplerate);
+    }
+    printf("\n\n");
+
+    free(rise_values);
+    free(fall_values);
+    free(width_values);
+    free(pairs);
+    return 0;
+}
+
+static void CORR__usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-f MHz] [-r Hz] [-t us] [-p pairs.csv] -c COLUMN=analyzer [-c ...] events.csv capture.csv\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    const char *paths[2] = { NULL, NULL };
+    unsigned int path_count = 0U;
+    FILE *in;
+    int result = EXIT_SUCCESS;
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-f") == 0) && (i + 1 < argc))
+        {
+            corr_mhz = strtod(argv[++i], NULL);
+        }
+        else if ((strcmp(argv[i], "-r") == 0) && (i + 1 < argc))
+        {
+            corr_samplerate = strtod(argv[++i], NULL);
+        }
+        else if ((strcmp(argv[i], "-t") == 0) && (i + 1 < argc))
+        {
+            corr_tolerance_ns = strtod(argv[++i], NULL) * 1000.0;
+        }
+        else if ((strcmp(argv[i], "-p") == 0) && (i + 1 < argc) && (corr_pairs_out == NULL))
+        {
+            corr_pairs_out = fopen(argv[++i], "w");
+            if (corr_pairs_out == NULL)
+            {
+                perror(argv[i]);
+                return EXIT_FAILURE;
+            }
+            fprintf(corr_pairs_out, "column,edge,internal_ns,external_ns,residual_ns\n");
+        }
+        else if ((strcmp(argv[i], "-c") == 0) && (i + 1 < argc) && (corr_channel_count < CORR_MAX_CHANNELS) &&
+                 (strchr(argv[i + 1], '=') != NULL))
+        {
+            CORR_Channel_t *const ch = &corr_channels[corr_channel_count++];
+            const char *map = argv[++i];
+            size_t length = (size_t)(strchr(map, '=') - map);
+
+            snprintf(ch->column, sizeof(ch->column), "%.*s", (int)length, map);
+            snprintf(ch->analyzer, sizeof(ch->analyzer), "%s", &map[length + 1U]);
+            ch->index = -1;
+            ch->level = -1;
+        }
+        else if ((argv[i][0] != '-') && (path_count < 2U))
+        {
+            paths[path_count++] = argv[i];
+        }
+        else
+        {
+            CORR__usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if ((path_count != 2U) || (corr_channel_count == 0U) || (corr_mhz <= 0.0) || (corr_tolerance_ns <= 0.0))
+    {
+        CORR__usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    in = fopen(paths[0], "r");
+    if (in == NULL)
+    {
+        perror(paths[0]);
+        return EXIT_FAILURE;
+    }
+    CORR__readEvents(in);
+    (void)fclose(in);
+
+    in = fopen(paths[1], "r");
+    if (in == NULL)
+    {
+        perror(paths[1]);
+        return EXIT_FAILURE;
+    }
+    if (CORR__readCapture(in) != 0)
+    {
+        (void)fclose(in);
+        return EXIT_FAILURE;
+    }
+    (void)fclose(in);
+
+    for (unsigned int c = 0U; c < corr_channel_count; c++)
+    {
+        if (CORR__report(&corr_channels[c]) != 0)
+        {
+            result = EXIT_FAILURE;
+        }
+    }
+
+    if ((corr_pairs_out != NULL) && (fclose(corr_pairs_out) != 0))
+    {
+        result = EXIT_FAILURE;
+    }
+    return result;
+}
+
+/* NOTE
+ *
+ * 1. The CPU and the logic analyzer run from different crystals, typically some 10 ppm apart,
+ * i.e. tens of us per second. A single offset would therefore only line up the edges near the
+ * first pair. Each edge is predicted from the last pair instead, where the clock difference over
+ * one edge distance is negligible, and once the pairs span CORR_MIN_SPAN_NS the ratio of the two
+ * spans corrects it as well. The report uses one least squares line over all pairs: its slope is
+ * the clock deviation, its offset contains the constant part of the pin latency (which the CPU
+ * can not see), and what is left per edge is the jitter of the latency plus the sampling error of
+ * the logic analyzer. The high time comparison is the width of each pulse on the pin against the
+ * distance of its two internal timestamps in logic analyzer time (times the slope), otherwise the
+ * clock deviation (100 ppm are 100 ns on a 1 ms pulse) would show up as width error.
+ */
+
+/* [ta_correlate.c] END OF FILE */
@@ -0,0 +1,313 @@
+/**
+* \file <ta_decode.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Host decoder of the binary Timing Analyzer stream (TAWire.h)
+*
+* Reads the raw UART byte stream from a file or stdin (e.g. a capture of the serial port),
+* splits it at the 0x00 delimiters, checks every frame and prints one text line per record.
+* Event timestamps are rebuilt to absolute 64 bit cycle counts. Plain text between the frames
+* (TA_printStatus output on the same UART) is passed through unchanged.
+*
+*   ta_decode [-f MHz] [--csv] [capture.bin]
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "TAWire.h"
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+#define DECODE_DEFAULT_MHZ          (24.0)
+#define DECODE_MAX_FRAME            (1024U)
+#define DECODE_MAX_IDS              (256U)
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+static const char *const decode_event_names[TATRACE_EVT_COUNT] = { "START", "PAUSE", "RESUME", "STOP", "PIN_HI", "PIN_LO", "CREATE" };
+static const char *const decode_state_names[] = { "IDLE", "RUNNING", "PAUSED", "STOPPED" };
+
+static char decode_names[DECODE_MAX_IDS][TAWIRE_NAME_MAX + 1U];
+static double decode_mhz = DECODE_DEFAULT_MHZ;
+static int decode_csv = 0;
+
+static uint64_t decode_time = 0ULL;         // Absolute cycles of the last event
+static uint32_t decode_last_raw = 0UL;      // Its 32 bit counter value
+static int decode_has_time = 0;
+
+static unsigned long decode_frames = 0UL;
+static unsigned long decode_bad_frames = 0UL;
+
+/*****************************************************************************/
+/* Function implementation                                                   */
+/*****************************************************************************/
+
+static const char *DECODE__name(uint8_t const id)
+{
+    static char unknown[16];
+
+    if (decode_names[id][0] != '\0')
+    {
+        return decode_names[id];
+    }
+    snprintf(unknown, sizeof(unknown), "#%u", id);
+    return unknown;
+}
+
+/**
+ * Func to print an analyzer name as a quoted CSV field, the names may contain commas.
+ * \param const char *const name    : [IN] analyzer name
+ * \return None
+*/
+static void DECODE__csvName(const char *const name)
+{
+    putchar('"');
+    for (char const *c = name; *c != '\0'; c++)
+    {
+        if (*c == '"')
+        {
+            putchar('"');                       // Quotes are doubled in CSV
+        }
+        putchar(*c);
+    }
+    putchar('"');
+}
+
+/**
+ * Func to turn the 32 bit timestamp of the first event of a frame into the absolute time,
+ * assuming less than one counter wrap between two frames.
+ * \param uint32_t const raw        : [IN] absolute 32 bit counter value
+ * \return None
+*/
+static void DECODE__syncTime(uint32_t const raw)
+{
+    if (decode_has_time == 0)
+    {
+        decode_time = raw;
+    }
+    else
+    {
+        decode_time += (uint32_t)(raw - decode_last_raw);
+    }
+    decode_last_raw = raw;
+    decode_has_time = 1;
+}
+
+/**
+ * Func to print all records of one checked frame.
+ * \param uint8_t const *const data : [IN] records
+ * \param uint16_t const length     : [IN] number of bytes
+ * \return 0 when all records were understood
+*/
+static int DECODE__records(uint8_t const *const data, uint16_t const length)
+{
+    TA_WireReader_t reader;
+    TA_WireRecord_t record;
+    RC_t res;
+
+    (void)TAWIRE_readBegin(&reader, data, length);
+    while ((res = TAWIRE_readNext(&reader, &record)) == RC_SUCCESS)
+    {
+        if (record.tag == TAWIRE_TAG_EVENT)
+        {
+            if (record.absolute == TRUE)
+            {
+                DECODE__syncTime(record.timestamp);
+            }
+            else
+            {
+                decode_time     += record.timestamp;
+                decode_last_raw += record.timestamp;
+            }
+
+            if (decode_csv != 0)
+            {
+                printf("event,%llu,%.3f,%s,", (unsigned long long)decode_time, (double)decode_time / decode_mhz,
+                       decode_event_names[record.type]);
+                DECODE__csvName(DECODE__name(record.id));
+                printf(",%u\n", record.ctx);
+            }
+            else
+            {
+                printf("%14llu cyc %14.3f us  %-6s %-24s ctx %u\n",
+                       (unsigned long long)decode_time, (double)decode_time / decode_mhz,
+                       decode_event_names[record.type], DECODE__name(record.id), record.ctx);
+            }
+        }
+        else if (record.tag == TAWIRE_TAG_NAME)
+        {
+            memcpy(decode_names[record.id], record.name, sizeof(record.name));
+        }
+        else if (record.tag == TAWIRE_TAG_STATS)
+        {
+            TA_WireStats_t const *const st = &record.stats;
+            const char *const state = (st->state < 4U) ? decode_state_names[st->state] : "UNKNOWN";
+
+            if (decode_csv != 0)
+            {
+                printf("stats,");
+                DECODE__csvName(DECODE__name(st->id));
+                printf(",%u,%s,%lu,%lu,%lu,%lu,%lu,%lu\n", st->mode, state,
+                       (unsigned long)st->elapsed, (unsigned long)st->count, (unsigned long)st->min,
+                       (unsigned long)st->max, (unsigned long)st->mean, (unsigned long)st->stddev);
+            }
+            else
+            {
+                printf("Name: %s | Mode: %u | State: %s | Elapsed: %lu | Runs: %lu | Min: %lu | Max: %lu | Mean: %lu | StdDev: %lu\n",
+                       DECODE__name(st->id), st->mode, state,
+                       (unsigned long)st->elapsed, (unsigned long)st->count, (unsigned long)st->min,
+                       (unsigned long)st->max, (unsigned long)st->mean, (unsigned long)st->stddev);
+            }
+        }
+        else
+        {
+            printf(decode_csv ? "dropped,%lu\n" : "Dropped events: %lu\n", (unsigned long)record.dropped);
+        }
+    }
+    return (res == RC_ERROR_BUFFER_EMTPY) ? 0 : -1;
+}
+
+/**
+ * Func to check whether a block between two delimiters is text output instead of a frame.
+ * \param uint8_t const *const data : [IN] bytes
+ * \param uint16_t const length     : [IN] number of bytes
+ * \return 1 for printable ASCII only (incl. CR, LF, TAB)
+*/
+static int DECODE__isText(uint8_t const *const data, uint16_t const length)
+{
+    for (uint16_t i = 0U; i < length; i++)
+    {
+        if (((data[i] < 0x20U) || (data[i] > 0x7EU)) && (data[i] != '\r') && (data[i] != '\n') && (data[i] != '\t'))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void DECODE__usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-f MHz] [--csv] [capture.bin]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    static uint8_t frame[DECODE_MAX_FRAME];
+    const char *path = NULL;
+    FILE *in = stdin;
+    uint16_t length = 0U;
+    int overflow = 0;
+    int c, i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-f") == 0) && (i + 1 < argc))
+        {
+            decode_mhz = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--csv") == 0)
+        {
+            decode_csv = 1;
+        }
+        else if ((argv[i][0] != '-') && (path == NULL))
+        {
+            path = argv[i];
+        }
+        else
+        {
+            DECODE__usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (decode_mhz <= 0.0)
+    {
+        DECODE__usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (path != NULL)
+    {
+        in = fopen(path, "rb");
+        if (in == NULL)
+        {
+            perror(path);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Collect bytes up to the next delimiter, then decode the frame
+    while ((c = fgetc(in)) != EOF)
+    {
+        if ((uint8_t)c != TAWIRE_DELIMITER)
+        {
+            if (length < DECODE_MAX_FRAME)
+            {
+                frame[length++] = (uint8_t)c;
+            }
+            else
+            {
+                overflow = 1;
+            }
+            continue;
+        }
+
+        if ((length != 0U) && (overflow == 0) && (DECODE__isText(frame, length) != 0))
+        {
+            // A frame always ends with CRC bytes, text can only be a false positive with a tiny chance
+            uint16_t records;
+            uint8_t copy[DECODE_MAX_FRAME];
+
+            memcpy(copy, frame, length);
+            if (TAWIRE_decode(copy, length, &records) != RC_SUCCESS)
+            {
+                if (decode_csv == 0)
+                {
+                    (void)fwrite(frame, 1U, length, stdout);
+                }
+                length = 0U;
+                continue;
+            }
+        }
+
+        if (length != 0U)
+        {
+            uint16_t records;
+
+            decode_frames++;
+            if ((overflow != 0) || (TAWIRE_decode(frame, length, &records) != RC_SUCCESS) ||
+                (DECODE__records(frame, records) != 0))
+            {
+                decode_bad_frames++;
+            }
+        }
+        length = 0U;
+        overflow = 0;
+    }
+
+    if (in != stdin)
+    {
+        (void)fclose(in);
+    }
+
+    fprintf(stderr, "%lu frames, %lu corrupted\n", decode_frames, decode_bad_frames);
+    return (decode_bad_frames == 0UL) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* [ta_decode.c] END OF FILE */
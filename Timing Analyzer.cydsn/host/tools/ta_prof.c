@@ -0,0 +1,643 @@
+/**
+* \file <ta_prof.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Host report of the function profiler (TAProf.h) and the sampling profiler (TASample.h)
+*
+* Reads the PROF lines of TAPROF_printStatus and the SAMPLE lines of TASAMPLE_printStatus from a
+* UART capture (other text is skipped) and resolves the addresses with the symbols of the firmware,
+* either from the linker map (Timing Analyzer.map, -ffunction-sections input sections and global
+* symbols) or from the output of nm for the .elf. Prints the flat profile sorted by exclusive cycles
+* and the call edges, and the sampled PCs summed up per function as a ranked hot-function list.
+*
+*   ta_prof [-f MHz] [-m firmware.map] [-n symbols.txt] [capture.txt]
+*   arm-none-eabi-nm -n "Timing Analyzer.elf" > symbols.txt
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+#define PROF_LINE_SIZE              (1024U)
+#define PROF_NAME_SIZE              (128U)
+#define PROF_NAME_COUNT             (8U)            // Rotating result buffers of PROF__name
+#define PROF_OUT_SIZE               (PROF_NAME_SIZE + 24U)   // Name + "+0x" + 16 hex digits
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+typedef struct {
+    unsigned long long addr;
+    char name[PROF_NAME_SIZE];
+} PROF_Symbol_t;
+
+typedef struct {
+    unsigned long long fn;
+    unsigned long calls;
+    unsigned long long incl;
+    unsigned long long excl;
+} PROF_Func_t;
+
+typedef struct {
+    unsigned long long addr;
+    unsigned long count;
+} PROF_Sample_t;
+
+typedef struct {
+    char name[PROF_NAME_SIZE];
+    unsigned long count;
+} PROF_Hot_t;
+
+typedef struct {
+    unsigned long long caller;
+    unsigned long long callee;
+    unsigned long calls;
+    unsigned long long incl;
+} PROF_Edge_t;
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+static PROF_Symbol_t *prof_symbols = NULL;
+static size_t prof_symbol_count = 0U;
+static size_t prof_symbol_size = 0U;
+
+static PROF_Func_t *prof_funcs = NULL;
+static size_t prof_func_count = 0U;
+static PROF_Edge_t *prof_edges = NULL;
+static size_t prof_edge_count = 0U;
+
+static double prof_mhz = 0.0;               // From the PROF BEGIN line unless given with -f
+static unsigned long prof_overhead = 0UL;
+static unsigned long prof_dropped_funcs = 0UL;
+static unsigned long prof_dropped_edges = 0UL;
+static unsigned long prof_too_deep = 0UL;
+static int prof_has_profile = 0;
+
+static PROF_Sample_t *prof_pcs = NULL;
+static size_t prof_pc_count = 0U;
+static PROF_Sample_t *prof_lrs = NULL;
+static size_t prof_lr_count = 0U;
+static PROF_Hot_t *prof_analyzers = NULL;
+static size_t prof_analyzer_count = 0U;
+static unsigned long prof_sample_hz = 0UL;
+static unsigned long prof_sample_total = 0UL;
+static unsigned long prof_sample_lost = 0UL;
+static unsigned long prof_sample_unattributed = 0UL;
+static int prof_has_samples = 0;
+
+/*****************************************************************************/
+/* Function implementation                                                   */
+/*****************************************************************************/
+
+static void *PROF__grow(void *array, size_t const count, size_t *const size, size_t const element)
+{
+    if (count < *size)
+    {
+        return array;
+    }
+    *size = (*size == 0U) ? 256U : (*size * 2U);
+    array = realloc(array, *size * element);
+    if (array == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    return array;
+}
+
+static void PROF__addSymbol(unsigned long long const addr, const char *const name)
+{
+    prof_symbols = PROF__grow(prof_symbols, prof_symbol_count, &prof_symbol_size, sizeof(PROF_Symbol_t));
+    prof_symbols[prof_symbol_count].addr = addr;
+    snprintf(prof_symbols[prof_symbol_count].name, PROF_NAME_SIZE, "%s", name);
+    prof_symbol_count++;
+}
+
+/**
+ * Func to read the code symbols printed by nm ("address type name", types T, t, W, w).
+ * \param const char *const path    : [IN] file
+ * \return 0 when success
+*/
+static int PROF__readNm(const char *const path)
+{
+    char line[PROF_LINE_SIZE];
+    FILE *in = fopen(path, "r");
+
+    if (in == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), in) != NULL)
+    {
+        unsigned long long addr;
+        char type;
+        char name[PROF_NAME_SIZE];
+
+        if ((sscanf(line, "%llx %c %127s", &addr, &type, name) == 3) && (strchr("TtWw", type) != NULL))
+        {
+            PROF__addSymbol(addr, name);
+        }
+    }
+    (void)fclose(in);
+    return 0;
+}
+
+/**
+ * Func to read the linker map: " .text.name 0xaddr 0xsize file" input sections (also wrapped onto
+ * the next line when the name is long) and "0xaddr name" symbol lines.
+ * \param const char *const path    : [IN] file
+ * \return 0 when success
+*/
+static int PROF__readMap(const char *const path)
+{
+    char line[PROF_LINE_SIZE];
+    char pending[PROF_NAME_SIZE] = "";
+    FILE *in = fopen(path, "r");
+
+    if (in == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), in) != NULL)
+    {
+        unsigned long long addr, size;
+        char name[PROF_NAME_SIZE];
+        char rest[PROF_NAME_SIZE];
+
+        if (sscanf(line, " .text.%127s 0x%llx 0x%llx", name, &addr, &size) == 3)
+        {
+            if (addr != 0ULL)
+            {
+                PROF__addSymbol(addr, name);
+            }
+            pending[0] = '\0';
+        }
+        else if (sscanf(line, " .text.%127s %127s", name, rest) == 1)
+        {
+            snprintf(pending, sizeof(pending), "%s", name);       // Address follows on the next line
+        }
+        else if ((pending[0] != '\0') && (sscanf(line, " 0x%llx 0x%llx", &addr, &size) == 2))
+        {
+            if (addr != 0ULL)
+            {
+                PROF__addSymbol(addr, pending);
+            }
+            pending[0] = '\0';
+        }
+        else if ((sscanf(line, " 0x%llx %127s %127s", &addr, name, rest) == 2) &&
+                 ((isalpha((unsigned char)name[0]) != 0) || (name[0] == '_')))
+        {
+            PROF__addSymbol(addr, name);
+            pending[0] = '\0';
+        }
+        else
+        {
+            pending[0] = '\0';
+        }
+    }
+    (void)fclose(in);
+    return 0;
+}
+
+static int PROF__compareSymbols(const void *a, const void *b)
+{
+    unsigned long long x = ((PROF_Symbol_t const *)a)->addr;
+    unsigned long long y = ((PROF_Symbol_t const *)b)->addr;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * Func which finds the symbol of a code address, the Thumb bit is ignored.
+ * \param unsigned long long const addr : [IN] address
+ * \return index of the symbol with the highest address not above addr, -1 when there is none
+*/
+static long PROF__symbol(unsigned long long const addr)
+{
+    unsigned long long even = addr & ~1ULL;
+    size_t low = 0U;
+    size_t high = prof_symbol_count;
+
+    // Last symbol with symbol.addr <= addr
+    while (low < high)
+    {
+        size_t mid = (low + high) / 2U;
+
+        if ((prof_symbols[mid].addr & ~1ULL) <= even)
+        {
+            low = mid + 1U;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return (long)low - 1L;
+}
+
+/**
+ * Func which returns the name of a function address, the Thumb bit is ignored.
+ * \param unsigned long long const fn   : [IN] address from the PROF lines
+ * \return symbol with the highest address not above fn, the address itself when no symbol matches
+*/
+static const char *PROF__name(unsigned long long const fn)
+{
+    static char buffer[PROF_NAME_COUNT][PROF_OUT_SIZE];
+    static unsigned int next = 0U;
+    unsigned long long addr = fn & ~1ULL;
+    char *out = buffer[next++ % PROF_NAME_COUNT];
+    long sym;
+
+    if (fn == 0ULL)
+    {
+        return "<root>";
+    }
+
+    sym = PROF__symbol(fn);
+    if (sym < 0L)
+    {
+        snprintf(out, PROF_OUT_SIZE, "0x%08llx", fn);
+    }
+    else if ((prof_symbols[sym].addr & ~1ULL) == addr)
+    {
+        snprintf(out, PROF_OUT_SIZE, "%s", prof_symbols[sym].name);
+    }
+    else
+    {
+        snprintf(out, PROF_OUT_SIZE, "%s+0x%llx", prof_symbols[sym].name, addr - (prof_symbols[sym].addr & ~1ULL));
+    }
+    return out;
+}
+
+/**
+ * Func to read one SAMPLE line.
+ * \param char const *const p       : [IN] line from "SAMPLE " on
+ * \return 1 when the line was understood
+*/
+static int PROF__readSample(char const *const p)
+{
+    static size_t pc_size = 0U;
+    static size_t lr_size = 0U;
+    static size_t analyzer_size = 0U;
+    PROF_Sample_t sample;
+    PROF_Hot_t hot;
+    int name_pos = 0;
+
+    if (sscanf(p, "SAMPLE BEGIN %lu %lu %lu %lu", &prof_sample_hz, &prof_sample_total, &prof_sample_lost,
+               &prof_sample_unattributed) == 4)
+    {
+        // A new dump replaces the previous one
+        prof_pc_count       = 0U;
+        prof_lr_count       = 0U;
+        prof_analyzer_count = 0U;
+        prof_has_samples    = 1;
+        return 1;
+    }
+    if (sscanf(p, "SAMPLE PC %llx %lu", &sample.addr, &sample.count) == 2)
+    {
+        prof_pcs = PROF__grow(prof_pcs, prof_pc_count, &pc_size, sizeof(PROF_Sample_t));
+        prof_pcs[prof_pc_count++] = sample;
+        return 1;
+    }
+    if (sscanf(p, "SAMPLE LR %llx %lu", &sample.addr, &sample.count) == 2)
+    {
+        prof_lrs = PROF__grow(prof_lrs, prof_lr_count, &lr_size, sizeof(PROF_Sample_t));
+        prof_lrs[prof_lr_count++] = sample;
+        return 1;
+    }
+    if ((sscanf(p, "SAMPLE TA %lu %n", &hot.count, &name_pos) == 1) && (name_pos != 0))
+    {
+        // The name is the rest of the line and may contain blanks
+        snprintf(hot.name, sizeof(hot.name), "%s", &p[name_pos]);
+        hot.name[strcspn(hot.name, "\r\n")] = '\0';
+        prof_analyzers = PROF__grow(prof_analyzers, prof_analyzer_count, &analyzer_size, sizeof(PROF_Hot_t));
+        prof_analyzers[prof_analyzer_count++] = hot;
+        return 1;
+    }
+    return (strncmp(p, "SAMPLE END", 10U) == 0) ? 1 : 0;
+}
+
+/**
+ * Func to read the PROF and SAMPLE lines of a capture, everything else is skipped.
+ * \param FILE *in                  : [IN] capture
+ * \return number of PROF and SAMPLE lines
+*/
+static unsigned long PROF__readCapture(FILE *in)
+{
+    static size_t func_size = 0U;
+    static size_t edge_size = 0U;
+    char line[PROF_LINE_SIZE];
+    unsigned long lines = 0UL;
+
+    while (fgets(line, sizeof(line), in) != NULL)
+    {
+        char const *p = strstr(line, "PROF ");
+        char const *sample = strstr(line, "SAMPLE ");
+        unsigned long hz;
+        PROF_Func_t func;
+        PROF_Edge_t edge;
+
+        if (sample != NULL)
+        {
+            lines += (unsigned long)PROF__readSample(sample);
+            continue;
+        }
+        if (p == NULL)
+        {
+            continue;
+        }
+        if (sscanf(p, "PROF BEGIN %lu %lu %lu %lu %lu", &hz, &prof_overhead, &prof_dropped_funcs,
+                   &prof_dropped_edges, &prof_too_deep) == 5)
+        {
+            // A new dump replaces the previous one
+            prof_func_count  = 0U;
+            prof_edge_count  = 0U;
+            prof_has_profile = 1;
+            if (prof_mhz <= 0.0)
+            {
+                prof_mhz = (double)hz / 1e6;
+            }
+            lines++;
+        }
+        else if (sscanf(p, "PROF FN %llx %lu %llu %llu", &func.fn, &func.calls, &func.incl, &func.excl) == 4)
+        {
+            prof_funcs = PROF__grow(prof_funcs, prof_func_count, &func_size, sizeof(PROF_Func_t));
+            prof_funcs[prof_func_count++] = func;
+            lines++;
+        }
+        else if (sscanf(p, "PROF EDGE %llx %llx %lu %llu", &edge.caller, &edge.callee, &edge.calls, &edge.incl) == 4)
+        {
+            prof_edges = PROF__grow(prof_edges, prof_edge_count, &edge_size, sizeof(PROF_Edge_t));
+            prof_edges[prof_edge_count++] = edge;
+            lines++;
+        }
+    }
+    return lines;
+}
+
+static int PROF__compareFuncs(const void *a, const void *b)
+{
+    unsigned long long x = ((PROF_Func_t const *)a)->excl;
+    unsigned long long y = ((PROF_Func_t const *)b)->excl;
+
+    return (x < y) - (x > y);
+}
+
+static int PROF__compareEdges(const void *a, const void *b)
+{
+    PROF_Edge_t const *x = (PROF_Edge_t const *)a;
+    PROF_Edge_t const *y = (PROF_Edge_t const *)b;
+
+    if (x->caller != y->caller)
+    {
+        return (x->caller > y->caller) - (x->caller < y->caller);
+    }
+    return (x->incl < y->incl) - (x->incl > y->incl);
+}
+
+static void PROF__reportProfile(void)
+{
+    unsigned long long total = 0ULL;
+
+    for (size_t i = 0U; i < prof_func_count; i++)
+    {
+        total += prof_funcs[i].excl;
+    }
+    qsort(prof_funcs, prof_func_count, sizeof(PROF_Func_t), PROF__compareFuncs);
+    qsort(prof_edges, prof_edge_count, sizeof(PROF_Edge_t), PROF__compareEdges);
+
+    printf("Flat profile (%.1f MHz, hook overhead %lu cycles per call)\n\n", prof_mhz, prof_overhead);
+    printf("%7s %14s %14s %10s %12s  %s\n", "excl %", "excl us", "incl us", "calls", "excl us/call", "function");
+    for (size_t i = 0U; i < prof_func_count; i++)
+    {
+        PROF_Func_t const *f = &prof_funcs[i];
+
+        printf("%7.2f %14.3f %14.3f %10lu %12.3f  %s\n",
+               (total != 0ULL) ? (100.0 * (double)f->excl / (double)total) : 0.0,
+               (double)f->excl / prof_mhz, (double)f->incl / prof_mhz, f->calls,
+               (f->calls != 0UL) ? ((double)f->excl / prof_mhz / (double)f->calls) : 0.0, PROF__name(f->fn));
+    }
+
+    printf("\nCall edges\n\n");
+    printf("%-40s %-40s %10s %14s\n", "caller", "callee", "calls", "incl us");
+    for (size_t i = 0U; i < prof_edge_count; i++)
+    {
+        PROF_Edge_t const *e = &prof_edges[i];
+
+        printf("%-40s %-40s %10lu %14.3f\n", PROF__name(e->caller), PROF__name(e->callee), e->calls, (double)e->incl / prof_mhz);
+    }
+
+    if ((prof_dropped_funcs != 0UL) || (prof_dropped_edges != 0UL) || (prof_too_deep != 0UL))
+    {
+        printf("\nIncomplete: %lu function calls and %lu edge calls found no table entry, %lu calls were nested too deep\n",
+               prof_dropped_funcs, prof_dropped_edges, prof_too_deep);
+    }
+}
+
+static int PROF__compareHot(const void *a, const void *b)
+{
+    unsigned long x = ((PROF_Hot_t const *)a)->count;
+    unsigned long y = ((PROF_Hot_t const *)b)->count;
+
+    return (x < y) - (x > y);
+}
+
+/**
+ * Func to sum up sampled addresses per function, ranked by count.
+ * \param PROF_Sample_t const *const samples : [IN] addresses with their counts
+ * \param size_t const count                 : [IN] number of addresses
+ * \param size_t *const hot_count            : [OUT] number of functions
+ * \return functions, to be freed by the caller
+*/
+static PROF_Hot_t *PROF__rank(PROF_Sample_t const *const samples, size_t const count, size_t *const hot_count)
+{
+    PROF_Hot_t *hot = calloc((count != 0U) ? count : 1U, sizeof(PROF_Hot_t));
+    size_t used = 0U;
+
+    if (hot == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0U; i < count; i++)
+    {
+        long sym = PROF__symbol(samples[i].addr);
+        char name[PROF_NAME_SIZE];
+        size_t j;
+
+        if (sym >= 0L)
+        {
+            snprintf(name, sizeof(name), "%s", prof_symbols[sym].name);
+        }
+        else
+        {
+            snprintf(name, sizeof(name), "0x%08llx", samples[i].addr);
+        }
+        for (j = 0U; (j < used) && (strcmp(hot[j].name, name) != 0); j++)
+        {
+        }
+        if (j == used)
+        {
+            snprintf(hot[used].name, sizeof(hot[used].name), "%s", name);
+            used++;
+        }
+        hot[j].count += samples[i].count;
+    }
+    qsort(hot, used, sizeof(PROF_Hot_t), PROF__compareHot);
+    *hot_count = used;
+    return hot;
+}
+
+static void PROF__reportSamples(void)
+{
+    double total = (prof_sample_total != 0UL) ? (double)prof_sample_total : 1.0;
+    size_t count;
+    PROF_Hot_t *hot = PROF__rank(prof_pcs, prof_pc_count, &count);
+
+    printf("Hot functions (%lu samples at %lu Hz, %lu lost)\n\n", prof_sample_total, prof_sample_hz, prof_sample_lost);
+    printf("%7s %10s  %s\n", "%", "samples", "function");
+    for (size_t i = 0U; i < count; i++)
+    {
+        printf("%7.2f %10lu  %s\n", 100.0 * (double)hot[i].count / total, hot[i].count, hot[i].name);
+    }
+    free(hot);
+
+    hot = PROF__rank(prof_lrs, prof_lr_count, &count);
+    printf("\nCallers by stacked LR (hint for leaf functions)\n\n");
+    printf("%7s %10s  %s\n", "%", "samples", "function");
+    for (size_t i = 0U; i < count; i++)
+    {
+        printf("%7.2f %10lu  %s\n", 100.0 * (double)hot[i].count / total, hot[i].count, hot[i].name);
+    }
+    free(hot);
+
+    qsort(prof_analyzers, prof_analyzer_count, sizeof(PROF_Hot_t), PROF__compareHot);
+    printf("\nInnermost running analyzer\n\n");
+    printf("%7s %10s  %s\n", "%", "samples", "analyzer");
+    for (size_t i = 0U; i < prof_analyzer_count; i++)
+    {
+        printf("%7.2f %10lu  %s\n", 100.0 * (double)prof_analyzers[i].count / total, prof_analyzers[i].count, prof_analyzers[i].name);
+    }
+    printf("%7.2f %10lu  %s\n", 100.0 * (double)prof_sample_unattributed / total, prof_sample_unattributed, "<none>");
+}
+
+static void PROF__usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-f MHz] [-m firmware.map] [-n symbols.txt] [capture.txt]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = NULL;
+    FILE *in = stdin;
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-f") == 0) && (i + 1 < argc))
+        {
+            prof_mhz = strtod(argv[++i], NULL);
+        }
+        else if ((strcmp(argv[i], "-m") == 0) && (i + 1 < argc))
+        {
+            if (PROF__readMap(argv[++i]) != 0)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc))
+        {
+            if (PROF__readNm(argv[++i]) != 0)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((argv[i][0] != '-') && (path == NULL))
+        {
+            path = argv[i];
+        }
+        else
+        {
+            PROF__usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (path != NULL)
+    {
+        in = fopen(path, "r");
+        if (in == NULL)
+        {
+            perror(path);
+            return EXIT_FAILURE;
+        }
+    }
+
+    qsort(prof_symbols, prof_symbol_count, sizeof(PROF_Symbol_t), PROF__compareSymbols);
+
+    // The map lists a function as input section and as symbol, keep one of them
+    if (prof_symbol_count > 1U)
+    {
+        size_t kept = 1U;
+
+        for (size_t j = 1U; j < prof_symbol_count; j++)
+        {
+            if ((prof_symbols[j].addr & ~1ULL) != (prof_symbols[kept - 1U].addr & ~1ULL))
+            {
+                prof_symbols[kept++] = prof_symbols[j];
+            }
+        }
+        prof_symbol_count = kept;
+    }
+
+    if (PROF__readCapture(in) == 0UL)
+    {
+        fprintf(stderr, "no PROF or SAMPLE lines found\n");
+        return EXIT_FAILURE;
+    }
+    if (in != stdin)
+    {
+        (void)fclose(in);
+    }
+    if (prof_has_profile != 0)
+    {
+        if (prof_mhz <= 0.0)
+        {
+            PROF__usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        PROF__reportProfile();
+    }
+    if (prof_has_samples != 0)
+    {
+        if (prof_has_profile != 0)
+        {
+            printf("\n");
+        }
+        PROF__reportSamples();
+    }
+    return EXIT_SUCCESS;
+}
+
+/* [ta_prof.c] END OF FILE */
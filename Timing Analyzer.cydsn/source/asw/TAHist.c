@@ -0,0 +1,188 @@
+/**
+* \file <TAHist.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Log-linear execution time histogram of the Timing Analyzer
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "project.h"
+#include "TAHist.h"
+#include "TimingAnalyzer.h"
+#include "UART_LOG.h"
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+#define TAHIST_PERMYRIAD           (10000UL)
+#define TAHIST_LINE_SIZE           (64U)
+#define TAHIST_MAX_VALUE           (4294967295UL)   /* 0xFFFFFFFFUL */
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * Func to clear all buckets.
+ * \param TA_Hist_t *const me       : [IN/OUT] histogram
+ * \return RC_SUCCESS when success and RC_ERROR_NULL when the me pointer is null
+*/
+RC_t TAHIST_clear(TA_Hist_t *const me)
+{
+    if (me == NULL_PTR)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    memset(me, 0, sizeof(TA_Hist_t));
+    
+    return RC_SUCCESS;
+}
+
+/**
+ * Func which returns the smallest value counted in a bucket.
+ * \param uint32_t const bucket     : [IN] bucket index 0 .. TAHIST_BUCKETS-1
+ * \return lower bound in counter units
+*/
+uint32_t TAHIST_getBucketLow(uint32_t const bucket)
+{
+    uint32_t shift;
+    
+    if (bucket < TAHIST_SUB_BUCKETS)
+    {
+        return bucket;
+    }
+    
+    // Inverse of TAHIST_getBucket: exponent from the upper bits, mantissa from the sub-bucket      (N1)
+    shift = (bucket >> TA_CFG_HIST_SUB_BITS) - 1UL;
+    return (TAHIST_SUB_BUCKETS | (bucket & TAHIST_SUB_MASK)) << shift;
+}
+
+/**
+ * Func which returns the largest value counted in a bucket.
+ * \param uint32_t const bucket     : [IN] bucket index 0 .. TAHIST_BUCKETS-1
+ * \return upper bound in counter units
+*/
+uint32_t TAHIST_getBucketHigh(uint32_t const bucket)
+{
+    if (bucket < TAHIST_SUB_BUCKETS)
+    {
+        return bucket;
+    }
+    
+    // Width of the bucket is 2^shift, the last bucket ends exactly at 0xFFFFFFFF
+    return TAHIST_getBucketLow(bucket) + ((1UL << ((bucket >> TA_CFG_HIST_SUB_BITS) - 1UL)) - 1UL);
+}
+
+/**
+ * Func which returns a percentile of the recorded values. The upper bound of the bucket is returned,
+ * so the result never underestimates (at most 2^-TA_CFG_HIST_SUB_BITS too high).
+ * \param TA_Hist_t const *const me         : [IN] histogram
+ * \param uint16_t const permyriad          : [IN] percentile in 1/10000 (TAHIST_P50 .. TAHIST_P100)
+ * \return value in counter units, 0 when the histogram is empty
+*/
+uint32_t TAHIST_getPercentile(TA_Hist_t const *const me, uint16_t const permyriad)
+{
+    uint64_t rank;
+    uint32_t seen = 0UL;
+    
+    if ((me == NULL_PTR) || (me->total == 0UL))
+    {
+        return 0UL;
+    }
+    
+    // Rank of the wanted value, rounded up, at least the first one      (N2)
+    rank = (((uint64_t)me->total * (uint64_t)permyriad) + (TAHIST_PERMYRIAD - 1UL)) / TAHIST_PERMYRIAD;
+    if (rank == 0ULL)
+    {
+        rank = 1ULL;
+    }
+    
+    for (uint32_t i = 0UL; i < TAHIST_BUCKETS; i++)
+    {
+        seen += me->bucket[i];
+        if ((uint64_t)seen >= rank)
+        {
+            return TAHIST_getBucketHigh(i);
+        }
+    }
+    
+    // Only reached for permyriad > TAHIST_P100
+    return TAHIST_MAX_VALUE;
+}
+
+/**
+ * Func to send all non empty buckets over UART as "low..high: count" lines. Waits for room in the log ring, main context only.
+ * \param TA_Hist_t const *const me         : [IN] histogram
+ * \param const char *const name            : [IN] title line, e.g. the analyzer name
+ * \return RC_SUCCESS when success and RC_ERROR_NULL when a pointer param is null
+*/
+RC_t TAHIST_dump(TA_Hist_t const *const me, const char *const name)
+{
+    char buffer[TAHIST_LINE_SIZE];
+    
+    if ((me == NULL_PTR) || (name == NULL_PTR))
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    snprintf(buffer, sizeof(buffer), "Histogram: %s | Total: %lu\r\n", name, (unsigned long)me->total);
+    TA_LOG_STRING_WAIT(buffer);
+    
+    for (uint32_t i = 0UL; i < TAHIST_BUCKETS; i++)
+    {
+        if (me->bucket[i] != 0UL)
+        {
+            snprintf(buffer, sizeof(buffer), "  %lu..%lu: %lu\r\n", (unsigned long)TAHIST_getBucketLow(i),
+                (unsigned long)TAHIST_getBucketHigh(i), (unsigned long)me->bucket[i]);
+            TA_LOG_STRING_WAIT(buffer);
+        }
+    }
+    
+    return RC_SUCCESS;
+}
+
+/* NOTE
+ *
+ * 1. Bucket layout for S = TA_CFG_HIST_SUB_BITS: values 0 .. 2^S-1 are stored exactly. A larger value
+ * with its most significant bit at position m goes to bucket (m-S+1)*2^S + (the S bits below the MSB).
+ * Every power of two range thus gets 2^S buckets of equal width 2^(m-S), i.e. the bucket width
+ * grows with the value and the relative error stays constant (HDR histogram idea).
+ *
+ * 2. Nearest rank method: the p-th percentile is the smallest recorded value with at least
+ * ceil(p * total) values below or equal to it.
+ */
+
+/* [TAHist.c] END OF FILE */
@@ -0,0 +1,138 @@
+/**
+* \file <TAHist.h>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Log-linear execution time histogram of the Timing Analyzer
+*
+* Constant memory distribution of the run durations of one analyzer, to query percentiles
+* (p50, p99, p99.9 ...) of e.g. an ISR. Buckets are HDR style: every power of two range is split
+* into 2^TA_CFG_HIST_SUB_BITS linear sub-buckets, so the relative error is bounded by
+* 2^-TA_CFG_HIST_SUB_BITS over the whole 32 bit range. Recording is one CLZ, a shift and an increment.
+*
+*   static TA_Hist_t isrHist;
+*   TA_create(&isr, TA_MODE_DWT, NULL_PTR, "ISR");
+*   TA_attachHistogram(&isr, &isrHist);      // every TA_stop records the run
+*   p99 = TAHIST_getPercentile(&isrHist, TAHIST_P99);
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+**/
+
+#ifndef TAHIST_H
+#define TAHIST_H
+
+#include "global.h"
+#include "TimingAnalyzer_config.h"
+
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### Defines/Macros
+#define TAHIST_SUB_BUCKETS      (1UL << TA_CFG_HIST_SUB_BITS)                       // Linear sub-buckets per power of two
+#define TAHIST_SUB_MASK         (TAHIST_SUB_BUCKETS - 1UL)
+#define TAHIST_BUCKETS          ((33UL - TA_CFG_HIST_SUB_BITS) << TA_CFG_HIST_SUB_BITS)  // 240 for 3 sub-bucket bits
+
+/* Percentiles in 1/10000, e.g. TAHIST_getPercentile(hist, TAHIST_P999) */
+#define TAHIST_P50              (5000U)
+#define TAHIST_P90              (9000U)
+#define TAHIST_P99              (9900U)
+#define TAHIST_P999             (9990U)
+#define TAHIST_P100             (10000U)
+
+//####################### Structures
+/**
+* \Histogram struct
+*
+* One bucket counter per value range, see TAHIST_getBucketLow / TAHIST_getBucketHigh for the ranges.
+* Values below TAHIST_SUB_BUCKETS have a bucket of their own (exact).
+*/
+typedef struct {
+    uint32_t total;                         // Number of recorded values
+    uint32_t bucket[TAHIST_BUCKETS];        // Count per bucket
+} TA_Hist_t;
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * Func which maps a value to its bucket index: values below 2^S directly, above by exponent and the S bits after the MSB.
+ * \param uint32_t const value      : [IN] value in counter units
+ * \return bucket index 0 .. TAHIST_BUCKETS-1
+*/
+STATIC_INLINE uint32_t TAHIST_getBucket(uint32_t const value)
+{
+    uint32_t msb;
+
+    if (value < TAHIST_SUB_BUCKETS)
+    {
+        return value;
+    }
+
+    msb = 31UL - (uint32_t)__builtin_clz(value);      // Single CLZ instruction on the Cortex-M3
+    return ((msb - TA_CFG_HIST_SUB_BITS + 1UL) << TA_CFG_HIST_SUB_BITS) | ((value >> (msb - TA_CFG_HIST_SUB_BITS)) & TAHIST_SUB_MASK);
+}
+
+/**
+ * Func to add one value to the histogram, O(1). Called by TA_stop when a histogram is attached.
+ * \param TA_Hist_t *const me       : [IN/OUT] histogram
+ * \param uint32_t const value      : [IN] value in counter units
+ * \return None
+*/
+STATIC_INLINE void TAHIST_record(TA_Hist_t *const me, uint32_t const value)
+{
+    me->bucket[TAHIST_getBucket(value)]++;
+    me->total++;
+}
+
+/**
+ * Func to clear all buckets.
+ * \param TA_Hist_t *const me       : [IN/OUT] histogram
+ * \return RC_SUCCESS when success and RC_ERROR_NULL when the me pointer is null
+*/
+RC_t TAHIST_clear(TA_Hist_t *const me);
+
+/**
+ * Func which returns the smallest value counted in a bucket.
+ * \param uint32_t const bucket     : [IN] bucket index 0 .. TAHIST_BUCKETS-1
+ * \return lower bound in counter units
+*/
+uint32_t TAHIST_getBucketLow(uint32_t const bucket);
+
+/**
+ * Func which returns the largest value counted in a bucket.
+ * \param uint32_t const bucket     : [IN] bucket index 0 .. TAHIST_BUCKETS-1
+ * \return upper bound in counter units
+*/
+uint32_t TAHIST_getBucketHigh(uint32_t const bucket);
+
+/**
+ * Func which returns a percentile of the recorded values. The upper bound of the bucket is returned,
+ * so the result never underestimates (at most 2^-TA_CFG_HIST_SUB_BITS too high).
+ * \param TA_Hist_t const *const me         : [IN] histogram
+ * \param uint16_t const permyriad          : [IN] percentile in 1/10000 (TAHIST_P50 .. TAHIST_P100)
+ * \return value in counter units, 0 when the histogram is empty
+*/
+uint32_t TAHIST_getPercentile(TA_Hist_t const *const me, uint16_t const permyriad);
+
+/**
+ * Func to send all non empty buckets over UART as "low..high: count" lines. Waits for room in the log ring, main context only.
+ * \param TA_Hist_t const *const me         : [IN] histogram
+ * \param const char *const name            : [IN] title line, e.g. the analyzer name
+ * \return RC_SUCCESS when success and RC_ERROR_NULL when a pointer param is null
+*/
+RC_t TAHIST_dump(TA_Hist_t const *const me, const char *const name);
+
+#endif /* TAHIST_H */
+
+/* [TAHist.h] END OF FILE */
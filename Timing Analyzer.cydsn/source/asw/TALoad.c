@@ -0,0 +1,263 @@
+/**
+* \file <TALoad.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief CPU load monitor of the Timing Analyzer
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "project.h"
+#include "TALoad.h"
+#include "TimingAnalyzer.h"
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+#define TALOAD_LINE_SIZE           (80U)
+#define TALOAD_PERCENT_DIGITS      (100U)      // TALOAD_FULL / 100
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+/* One load window */
+typedef struct {
+    uint32_t length;                            // Window length in DWT cycles
+    uint32_t start;                             // DWT->CYCCNT at the start of the running window
+    uint32_t idle;                              // Idle cycles in the running window
+    uint16_t load;                              // Load of the last completed window
+    uint16_t peak;                              // Highest load since the last reset
+    uint64_t self_start[TA_MAX_ANALYZERS];      // self_time of every analyzer at the window start
+    uint16_t share[TA_MAX_ANALYZERS];           // Share of every analyzer in the last completed window
+} TALOAD__Window_t;
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+static const uint32_t ta_g_load_window_ms[TA_CFG_LOAD_WINDOW_COUNT] = TA_CFG_LOAD_WINDOWS_MS;
+static TALOAD__Window_t ta_g_load_windows[TA_CFG_LOAD_WINDOW_COUNT];
+static uint32_t ta_g_load_last = 0UL;          // DWT->CYCCNT at the previous TALOAD_idle call
+static boolean_t ta_g_load_running = FALSE;     // FALSE until the first TALOAD_idle call after a reset
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+static void TALOAD__startWindow(TALOAD__Window_t *const window, uint32_t const now);
+static void TALOAD__closeWindow(TALOAD__Window_t *const window, uint32_t const now);
+static uint16_t TALOAD__ratio(uint32_t const part, uint32_t const whole);
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * Func to restart all windows and clear loads, peaks and shares.
+ * \param None
+ * \return None
+*/
+void TALOAD_reset(void)
+{
+    memset(ta_g_load_windows, 0, sizeof(ta_g_load_windows));
+    ta_g_load_running = FALSE;
+}
+
+/**
+ * Func to be called once per idle loop iteration. Sums the idle time and closes the windows which are over.
+ * \param None
+ * \return None
+*/
+void TALOAD_idle(void)
+{
+    uint32_t now = (uint32_t)TA_getCycles64();     // Also keeps the wrap epoch current without SysTick
+    uint32_t gap = now - ta_g_load_last;
+
+    ta_g_load_last = now;
+
+    // First call - the windows start here
+    if (ta_g_load_running == FALSE)
+    {
+        for (uint8_t w = 0U; w < TA_CFG_LOAD_WINDOW_COUNT; w++)
+        {
+            ta_g_load_windows[w].length = ta_g_load_window_ms[w] * BCLK__BUS_CLK__KHZ;
+            TALOAD__startWindow(&ta_g_load_windows[w], now);
+        }
+        ta_g_load_running = TRUE;
+        return;
+    }
+
+    for (uint8_t w = 0U; w < TA_CFG_LOAD_WINDOW_COUNT; w++)
+    {
+        TALOAD__Window_t *const window = &ta_g_load_windows[w];
+
+        // A short gap is one pass of the idle loop, a long one contains other work      (N1)
+        if (gap <= TA_CFG_LOAD_IDLE_GAP)
+        {
+            window->idle += gap;
+        }
+
+        if ((now - window->start) >= window->length)
+        {
+            TALOAD__closeWindow(window, now);
+        }
+    }
+}
+
+/**
+ * Func which returns the load of the last completed window.
+ * \param uint8_t const window      : [IN] index into TA_CFG_LOAD_WINDOWS_MS
+ * \return load in 1/100 %, 0 for an invalid window or before the first window is over
+*/
+uint16_t TALOAD_getLoad(uint8_t const window)
+{
+    return (window < TA_CFG_LOAD_WINDOW_COUNT) ? ta_g_load_windows[window].load : 0U;
+}
+
+/**
+ * Func which returns the highest load of all completed windows since the last reset.
+ * \param uint8_t const window      : [IN] index into TA_CFG_LOAD_WINDOWS_MS
+ * \return peak load in 1/100 %, 0 for an invalid window
+*/
+uint16_t TALOAD_getPeak(uint8_t const window)
+{
+    return (window < TA_CFG_LOAD_WINDOW_COUNT) ? ta_g_load_windows[window].peak : 0U;
+}
+
+/**
+ * Func which returns the share of one analyzer (its self_time) in the last completed window.
+ * \param uint8_t const window      : [IN] index into TA_CFG_LOAD_WINDOWS_MS
+ * \param uint8_t const id          : [IN] analyzer id, see TA_getAnalyzer
+ * \return share in 1/100 %, 0 for an invalid window or id
+*/
+uint16_t TALOAD_getShare(uint8_t const window, uint8_t const id)
+{
+    if ((window >= TA_CFG_LOAD_WINDOW_COUNT) || (id >= TA_MAX_ANALYZERS))
+    {
+        return 0U;
+    }
+    return ta_g_load_windows[window].share[id];
+}
+
+/**
+ * Func to send load, peak and the shares of the ISR analyzers of every window over UART.
+ * \param None
+ * \return RC_SUCCESS when success
+*/
+RC_t TALOAD_printStatus(void)
+{
+    char buffer[TALOAD_LINE_SIZE];
+
+    for (uint8_t w = 0U; w < TA_CFG_LOAD_WINDOW_COUNT; w++)
+    {
+        TALOAD__Window_t const *const window = &ta_g_load_windows[w];
+
+        snprintf(buffer, sizeof(buffer), "Load %lums: %u.%02u%% | Peak: %u.%02u%%\r\n", (unsigned long)ta_g_load_window_ms[w],
+            window->load / TALOAD_PERCENT_DIGITS, window->load % TALOAD_PERCENT_DIGITS,
+            window->peak / TALOAD_PERCENT_DIGITS, window->peak % TALOAD_PERCENT_DIGITS);
+        TA_LOG_STRING(buffer);
+
+        // Shares of the analyzers which run in an exception context
+        for (uint8_t id = 0U; id < TA_MAX_ANALYZERS; id++)
+        {
+            TA_t const *const analyzer = TA_getAnalyzer(id);
+
+            if ((analyzer != NULL_PTR) && (analyzer->ctx != 0U))
+            {
+                snprintf(buffer, sizeof(buffer), "      %s: %u.%02u%%\r\n", analyzer->name,
+                    window->share[id] / TALOAD_PERCENT_DIGITS, window->share[id] % TALOAD_PERCENT_DIGITS);
+                TA_LOG_STRING(buffer);
+            }
+        }
+    }
+
+    return RC_SUCCESS;
+}
+
+/**
+ * Func to begin a new window and take the self_time of every analyzer as reference.
+ * \param TALOAD__Window_t *const window    : [IN/OUT] window
+ * \param uint32_t const now                : [IN] DWT->CYCCNT
+ * \return None
+*/
+static void TALOAD__startWindow(TALOAD__Window_t *const window, uint32_t const now)
+{
+    window->start = now;
+    window->idle  = 0UL;
+
+    for (uint8_t id = 0U; id < TA_MAX_ANALYZERS; id++)
+    {
+        TA_t const *const analyzer = TA_getAnalyzer(id);
+
+        window->self_start[id] = (analyzer != NULL_PTR) ? analyzer->self_time : 0ULL;
+    }
+}
+
+/**
+ * Func to evaluate a completed window and start the next one.
+ * \param TALOAD__Window_t *const window    : [IN/OUT] window
+ * \param uint32_t const now                : [IN] DWT->CYCCNT
+ * \return None
+*/
+static void TALOAD__closeWindow(TALOAD__Window_t *const window, uint32_t const now)
+{
+    uint32_t span = now - window->start;       // Real length, at least window->length     (N2)
+    uint32_t idle = (window->idle < span) ? window->idle : span;
+
+    window->load = TALOAD__ratio(span - idle, span);
+    if (window->load > window->peak)
+    {
+        window->peak = window->load;
+    }
+
+    for (uint8_t id = 0U; id < TA_MAX_ANALYZERS; id++)
+    {
+        TA_t const *const analyzer = TA_getAnalyzer(id);
+
+        window->share[id] = (analyzer != NULL_PTR) ? TALOAD__ratio((uint32_t)(analyzer->self_time - window->self_start[id]), span) : 0U;
+    }
+
+    TALOAD__startWindow(window, now);
+}
+
+/**
+ * Func which returns part / whole in 1/100 %, limited to 100%.
+ * \param uint32_t const part       : [IN] cycles
+ * \param uint32_t const whole      : [IN] cycles, not 0
+ * \return ratio in 1/100 %
+*/
+static uint16_t TALOAD__ratio(uint32_t const part, uint32_t const whole)
+{
+    uint64_t ratio = ((uint64_t)part * TALOAD_FULL) / whole;
+
+    return (ratio > TALOAD_FULL) ? TALOAD_FULL : (uint16_t)ratio;
+}
+
+/* NOTE
+ *
+ * 1. Idle detection by gaps - the idle loop itself is not measured with an analyzer, only the
+ * distance between two TALOAD_idle calls. Up to TA_CFG_LOAD_IDLE_GAP cycles it is one pass of an
+ * idle loop which found nothing to do, a larger gap contains an ISR or background work and counts
+ * completely as busy. ISRs shorter than the gap are therefore seen as idle time; set the gap just
+ * above the cycles of one empty pass of your idle loop.
+ *
+ * 2. Windows are closed by the idle loop only, so a window ends at the first idle call after its
+ * length has passed. Load and shares are calculated over the real span, not the nominal length.
+ * The share of an analyzer is its self_time (TA_CFG_PREEMPTION) in the window, so the shares of
+ * nested ISRs do not count twice.
+ */
+
+/* [TALoad.c] END OF FILE */
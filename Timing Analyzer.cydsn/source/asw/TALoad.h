@@ -0,0 +1,96 @@
+/**
+* \file <TALoad.h>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief CPU load monitor of the Timing Analyzer
+*
+* The idle (background) loop calls TALOAD_idle once per iteration. Two calls which follow each other
+* within TA_CFG_LOAD_IDLE_GAP DWT cycles mean the CPU was idle in between, a longer gap means an ISR
+* or other work ran. The idle cycles are summed over each window of TA_CFG_LOAD_WINDOWS_MS; when a
+* window is over, its load, the peak load and the share of every analyzer (self_time, e.g. the ISR
+* analyzers) are updated. All values are in 1/100 percent (10000 = 100%).
+*
+*   for (;;)
+*   {
+*       TALOAD_idle();
+*       ...background work...
+*   }
+*
+* A window can only be closed by TALOAD_idle, at 100% load it is extended until the idle loop runs again.
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+**/
+
+#ifndef TALOAD_H
+#define TALOAD_H
+
+#include "global.h"
+#include "TimingAnalyzer_config.h"
+
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### Defines/Macros
+#define TALOAD_FULL             (10000U)    // 100.00%
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * Func to restart all windows and clear loads, peaks and shares.
+ * \param None
+ * \return None
+*/
+void TALOAD_reset(void);
+
+/**
+ * Func to be called once per idle loop iteration. Sums the idle time and closes the windows which are over.
+ * \param None
+ * \return None
+*/
+void TALOAD_idle(void);
+
+/**
+ * Func which returns the load of the last completed window.
+ * \param uint8_t const window      : [IN] index into TA_CFG_LOAD_WINDOWS_MS
+ * \return load in 1/100 %, 0 for an invalid window or before the first window is over
+*/
+uint16_t TALOAD_getLoad(uint8_t const window);
+
+/**
+ * Func which returns the highest load of all completed windows since the last reset.
+ * \param uint8_t const window      : [IN] index into TA_CFG_LOAD_WINDOWS_MS
+ * \return peak load in 1/100 %, 0 for an invalid window
+*/
+uint16_t TALOAD_getPeak(uint8_t const window);
+
+/**
+ * Func which returns the share of one analyzer (its self_time) in the last completed window.
+ * \param uint8_t const window      : [IN] index into TA_CFG_LOAD_WINDOWS_MS
+ * \param uint8_t const id          : [IN] analyzer id, see TA_getAnalyzer
+ * \return share in 1/100 %, 0 for an invalid window or id
+*/
+uint16_t TALOAD_getShare(uint8_t const window, uint8_t const id);
+
+/**
+ * Func to send load, peak and the shares of the ISR analyzers of every window over UART.
+ * \param None
+ * \return RC_SUCCESS when success
+*/
+RC_t TALOAD_printStatus(void);
+
+#endif /* TALOAD_H */
+
+/* [TALoad.h] END OF FILE */
@@ -0,0 +1,449 @@
+/**
+* \file <TAProf.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Whole-program function profiler of the Timing Analyzer (-finstrument-functions)
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "project.h"
+#include "TAProf.h"
+#include "TimingAnalyzer.h"
+
+#if (TA_CFG_PROFILER == ON)
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+#define TAPROF_LINE_SIZE            (96U)
+#define TAPROF_FUNC_MASK            (TA_CFG_PROF_FUNCS - 1U)
+#define TAPROF_EDGE_MASK            (TA_CFG_PROF_EDGES - 1U)
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+/* One active call on the shadow stack */
+typedef struct {
+    uintptr_t fn;
+    uint32_t start;                 // DWT->CYCCNT at the end of the enter hook
+    uint32_t child;                 // Cycles of the calls made so far, incl. their hook cost
+} TAPROF__Frame_t;
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+static TAPROF_Func_t taprof_g_funcs[TA_CFG_PROF_FUNCS];
+static TAPROF_Edge_t taprof_g_edges[TA_CFG_PROF_EDGES];
+static TAPROF__Frame_t taprof_g_stack[TA_CFG_PROF_DEPTH];
+static uint32_t taprof_g_depth = 0UL;                   // Active calls, may exceed TA_CFG_PROF_DEPTH
+static volatile boolean_t taprof_g_running = FALSE;
+static uint32_t taprof_g_residue = 0UL;                 // Hook cycles inside the own window of a call        (N2)
+static uint32_t taprof_g_overhead = 0UL;                // Hook cycles of a call outside its window, charged to the caller
+static uint32_t taprof_g_dropped_funcs = 0UL;
+static uint32_t taprof_g_dropped_edges = 0UL;
+static uint32_t taprof_g_too_deep = 0UL;
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+void __cyg_profile_func_enter(void *this_fn, void *call_site) TAPROF_NO_INSTRUMENT;
+void __cyg_profile_func_exit(void *this_fn, void *call_site) TAPROF_NO_INSTRUMENT;
+static TAPROF_Func_t *TAPROF__findFunc(uintptr_t const fn, boolean_t const insert) TAPROF_NO_INSTRUMENT;
+static TAPROF_Edge_t *TAPROF__findEdge(uintptr_t const caller, uintptr_t const callee) TAPROF_NO_INSTRUMENT;
+static void TAPROF__clear(void) TAPROF_NO_INSTRUMENT;
+static uint64_t TAPROF__calibrate(void (*const run)(void)) TAPROF_NO_INSTRUMENT;
+static void TAPROF__calibrationParent(void) TAPROF_NO_INSTRUMENT;
+static void TAPROF__calibrationChild(void) TAPROF_NO_INSTRUMENT;
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * Func called by gcc at the entry of every instrumented function. Pushes a frame on the shadow stack.
+ * \param void *this_fn             : [IN] address of the function
+ * \param void *call_site           : [IN] return address in the caller, not used (the caller is the frame below)
+ * \return None
+*/
+void __cyg_profile_func_enter(void *this_fn, void *call_site)
+{
+    uint8 intr;
+
+    (void)call_site;
+
+    if (taprof_g_running == FALSE)
+    {
+        return;
+    }
+
+    // ISRs push on top of the interrupted call, so one stack serves all levels   (N1)
+    intr = CyEnterCriticalSection();
+    if (taprof_g_depth < TA_CFG_PROF_DEPTH)
+    {
+        TAPROF__Frame_t *const frame = &taprof_g_stack[taprof_g_depth];
+
+        frame->fn    = (uintptr_t)this_fn;
+        frame->child = 0UL;
+        frame->start = DWT->CYCCNT;         // Last, the rest of the hook is not part of the call
+    }
+    else
+    {
+        taprof_g_too_deep++;
+    }
+    taprof_g_depth++;
+    CyExitCriticalSection(intr);
+}
+
+/**
+ * Func called by gcc at the exit of every instrumented function. Pops its frame and books the call.
+ * \param void *this_fn             : [IN] address of the function
+ * \param void *call_site           : [IN] return address in the caller, not used
+ * \return None
+*/
+void __cyg_profile_func_exit(void *this_fn, void *call_site)
+{
+    uint32_t now = DWT->CYCCNT;             // First, the rest of the hook is not part of the call
+    uint8 intr;
+
+    (void)this_fn;
+    (void)call_site;
+
+    if (taprof_g_running == FALSE)
+    {
+        return;
+    }
+
+    intr = CyEnterCriticalSection();
+
+    // Calls which were entered before TAPROF_start have no frame
+    if (taprof_g_depth == 0UL)
+    {
+        CyExitCriticalSection(intr);
+        return;
+    }
+    taprof_g_depth--;
+
+    if (taprof_g_depth < TA_CFG_PROF_DEPTH)
+    {
+        TAPROF__Frame_t const *const frame = &taprof_g_stack[taprof_g_depth];
+        uint32_t raw  = now - frame->start;
+        uint32_t incl = (raw > taprof_g_residue) ? (raw - taprof_g_residue) : 0UL;
+        uint32_t excl = (incl > frame->child) ? (incl - frame->child) : 0UL;
+        uintptr_t caller = (taprof_g_depth != 0UL) ? taprof_g_stack[taprof_g_depth - 1UL].fn : (uintptr_t)0U;
+        TAPROF_Func_t *const func = TAPROF__findFunc(frame->fn, TRUE);
+        TAPROF_Edge_t *const edge = TAPROF__findEdge(caller, frame->fn);
+
+        if (func != NULL_PTR)
+        {
+            func->calls++;
+            func->incl += incl;
+            func->excl += excl;
+        }
+        if (edge != NULL_PTR)
+        {
+            edge->calls++;
+            edge->incl += incl;
+        }
+        if (taprof_g_depth != 0UL)
+        {
+            taprof_g_stack[taprof_g_depth - 1UL].child += raw + taprof_g_overhead;
+        }
+    }
+
+    CyExitCriticalSection(intr);
+}
+
+/**
+ * Func to clear the profile. Profiling continues if it is running.
+ * \param None
+ * \return None
+*/
+void TAPROF_reset(void)
+{
+    uint8 intr = CyEnterCriticalSection();
+
+    TAPROF__clear();
+
+    CyExitCriticalSection(intr);
+}
+
+/**
+ * Func to calibrate the cost of the hooks, clear the profile and start profiling. Call after TA_init.
+ * \param None
+ * \return None
+*/
+void TAPROF_start(void)
+{
+    uint64_t empty;
+
+    // An empty function shows the residue, a caller of it additionally the cost outside the window
+    taprof_g_residue  = 0UL;
+    taprof_g_overhead = 0UL;
+    empty = TAPROF__calibrate(&TAPROF__calibrationChild);
+    taprof_g_residue  = (uint32_t)empty;
+    taprof_g_overhead = (uint32_t)TAPROF__calibrate(&TAPROF__calibrationParent);
+
+    TAPROF_reset();
+    taprof_g_depth   = 0UL;
+    taprof_g_running = TRUE;
+}
+
+/**
+ * Func to stop profiling, the profile is kept.
+ * \param None
+ * \return None
+*/
+void TAPROF_stop(void)
+{
+    taprof_g_running = FALSE;
+}
+
+/**
+ * Func which returns the profile of one function.
+ * \param uintptr_t const fn            : [IN] function address as reported in the PROF FN lines
+ * \param TAPROF_Func_t *const profile  : [OUT] copy of the profile
+ * \return RC_SUCCESS when success, RC_ERROR_NULL when profile is null and RC_ERROR_BAD_PARAM when fn was not profiled
+*/
+RC_t TAPROF_getFunction(uintptr_t const fn, TAPROF_Func_t *const profile)
+{
+    TAPROF_Func_t const *func;
+    uint8 intr;
+
+    if (profile == NULL_PTR)
+    {
+        return RC_ERROR_NULL;
+    }
+
+    intr = CyEnterCriticalSection();
+    func = TAPROF__findFunc(fn, FALSE);
+    if (func != NULL_PTR)
+    {
+        *profile = *func;
+    }
+    CyExitCriticalSection(intr);
+
+    return (func != NULL_PTR) ? RC_SUCCESS : RC_ERROR_BAD_PARAM;
+}
+
+/**
+ * Func to send the profile over UART as PROF lines for ta_prof. Waits for room in the log ring, main context only.
+ * \param None
+ * \return RC_SUCCESS when success
+*/
+RC_t TAPROF_printStatus(void)
+{
+    char buffer[TAPROF_LINE_SIZE];
+    char incl[TA_U64_DIGITS];
+    char excl[TA_U64_DIGITS];
+
+    snprintf(buffer, sizeof(buffer), "PROF BEGIN %lu %lu %lu %lu %lu\r\n", (unsigned long)BCLK__BUS_CLK__HZ,
+        (unsigned long)taprof_g_overhead, (unsigned long)taprof_g_dropped_funcs,
+        (unsigned long)taprof_g_dropped_edges, (unsigned long)taprof_g_too_deep);
+    TA_LOG_STRING_WAIT(buffer);
+
+    for (uint32_t i = 0UL; i < TA_CFG_PROF_FUNCS; i++)
+    {
+        TAPROF_Func_t func;
+        uint8 intr = CyEnterCriticalSection();
+
+        func = taprof_g_funcs[i];
+        CyExitCriticalSection(intr);
+
+        if (func.fn != (uintptr_t)0U)
+        {
+            snprintf(buffer, sizeof(buffer), "PROF FN 0x%08lx %lu %s %s\r\n", (unsigned long)func.fn, (unsigned long)func.calls,
+                TA_formatU64(incl, sizeof(incl), func.incl), TA_formatU64(excl, sizeof(excl), func.excl));
+            TA_LOG_STRING_WAIT(buffer);
+        }
+    }
+
+    for (uint32_t i = 0UL; i < TA_CFG_PROF_EDGES; i++)
+    {
+        TAPROF_Edge_t edge;
+        uint8 intr = CyEnterCriticalSection();
+
+        edge = taprof_g_edges[i];
+        CyExitCriticalSection(intr);
+
+        if (edge.callee != (uintptr_t)0U)
+        {
+            snprintf(buffer, sizeof(buffer), "PROF EDGE 0x%08lx 0x%08lx %lu %s\r\n", (unsigned long)edge.caller,
+                (unsigned long)edge.callee, (unsigned long)edge.calls, TA_formatU64(incl, sizeof(incl), edge.incl));
+            TA_LOG_STRING_WAIT(buffer);
+        }
+    }
+
+    TA_LOG_STRING_WAIT("PROF END\r\n");
+
+    return RC_SUCCESS;
+}
+
+/**
+ * Func which looks up a function in the open addressing table (linear probing).
+ * \param uintptr_t const fn        : [IN] function address, not 0
+ * \param boolean_t const insert    : [IN] TRUE to take a free entry when fn is not in the table yet
+ * \return entry, NULL_PTR when not found (insert: table full, counted as dropped)
+*/
+static TAPROF_Func_t *TAPROF__findFunc(uintptr_t const fn, boolean_t const insert)
+{
+    uint32_t slot = ((uint32_t)(fn >> 1) * TA_HASH_MUL) >> 16;
+
+    for (uint32_t probe = 0UL; probe < TA_CFG_PROF_FUNCS; probe++)
+    {
+        TAPROF_Func_t *const func = &taprof_g_funcs[(slot + probe) & TAPROF_FUNC_MASK];
+
+        if (func->fn == fn)
+        {
+            return func;
+        }
+        if (func->fn == (uintptr_t)0U)
+        {
+            if (insert == FALSE)
+            {
+                return NULL_PTR;
+            }
+            func->fn = fn;
+            return func;
+        }
+    }
+
+    if (insert != FALSE)
+    {
+        taprof_g_dropped_funcs++;
+    }
+    return NULL_PTR;
+}
+
+/**
+ * Func which looks up an edge and takes a free entry when it is new.
+ * \param uintptr_t const caller    : [IN] calling function, 0 on the lowest level
+ * \param uintptr_t const callee    : [IN] called function, not 0
+ * \return entry, NULL_PTR when the table is full (counted as dropped)
+*/
+static TAPROF_Edge_t *TAPROF__findEdge(uintptr_t const caller, uintptr_t const callee)
+{
+    uint32_t slot = ((uint32_t)((caller >> 1) ^ (callee << 3)) * TA_HASH_MUL) >> 16;
+
+    for (uint32_t probe = 0UL; probe < TA_CFG_PROF_EDGES; probe++)
+    {
+        TAPROF_Edge_t *const edge = &taprof_g_edges[(slot + probe) & TAPROF_EDGE_MASK];
+
+        if ((edge->callee == callee) && (edge->caller == caller))
+        {
+            return edge;
+        }
+        if (edge->callee == (uintptr_t)0U)
+        {
+            edge->caller = caller;
+            edge->callee = callee;
+            return edge;
+        }
+    }
+
+    taprof_g_dropped_edges++;
+    return NULL_PTR;
+}
+
+/**
+ * Func to clear both tables and the drop counters. Caller holds the critical section.
+ * \param None
+ * \return None
+*/
+static void TAPROF__clear(void)
+{
+    memset(taprof_g_funcs, 0, sizeof(taprof_g_funcs));
+    memset(taprof_g_edges, 0, sizeof(taprof_g_edges));
+    taprof_g_dropped_funcs = 0UL;
+    taprof_g_dropped_edges = 0UL;
+    taprof_g_too_deep      = 0UL;
+}
+
+/**
+ * Func which profiles one calibration function TA_CFG_CALIBRATION_RUNS times, interrupts can only make a run longer.
+ * \param void (*const run)(void)   : [IN] TAPROF__calibrationChild or TAPROF__calibrationParent
+ * \return smallest exclusive cycles of the function
+*/
+static uint64_t TAPROF__calibrate(void (*const run)(void))
+{
+    uint64_t best = UINT64_MAX;
+
+    for (uint32_t i = 0UL; i < TA_CFG_CALIBRATION_RUNS; i++)
+    {
+        TAPROF_Func_t const *func;
+
+        TAPROF_reset();
+        taprof_g_depth   = 0UL;
+        taprof_g_running = TRUE;
+        run();
+        taprof_g_running = FALSE;
+
+        func = TAPROF__findFunc((uintptr_t)run, FALSE);
+        if ((func != NULL_PTR) && (func->excl < best))
+        {
+            best = func->excl;
+        }
+    }
+
+    return (best != UINT64_MAX) ? best : 0ULL;
+}
+
+/**
+ * Func which plays the caller during the calibration, calls the hooks like an instrumented function.
+ * \param None
+ * \return None
+*/
+static void TAPROF__calibrationParent(void)
+{
+    __cyg_profile_func_enter((void *)&TAPROF__calibrationParent, NULL_PTR);
+    TAPROF__calibrationChild();
+    __cyg_profile_func_exit((void *)&TAPROF__calibrationParent, NULL_PTR);
+}
+
+/**
+ * Func which plays an empty callee during the calibration.
+ * \param None
+ * \return None
+*/
+static void TAPROF__calibrationChild(void)
+{
+    __cyg_profile_func_enter((void *)&TAPROF__calibrationChild, NULL_PTR);
+    __cyg_profile_func_exit((void *)&TAPROF__calibrationChild, NULL_PTR);
+}
+
+#endif /* TA_CFG_PROFILER */
+
+/* NOTE
+ *
+ * 1. One shadow stack for all contexts - hooks run with interrupts disabled, so an ISR can only
+ * enter between two hooks and its calls are pushed on top of the interrupted call and popped before
+ * it continues. The ISR functions show up as callees of the interrupted function: its inclusive time
+ * contains them, its exclusive time does not. A recursive function is counted once per level in its
+ * inclusive time, so it can exceed the total runtime.
+ *
+ * 2. The counter is read at the end of the enter hook and at the start of the exit hook. The end of
+ * the enter hook and the start of the exit hook still lie inside the window of the call (residue,
+ * subtracted from every call), the rest of both hooks (table lookups, critical section) lies outside
+ * it and runs between the instructions of the caller (overhead, counted as part of the call to the
+ * callee). TAPROF_start measures the residue with an empty function and the overhead with a caller
+ * of it, so exclusive times do not grow with the number of calls made. Calls deeper than
+ * TA_CFG_PROF_DEPTH are counted (too_deep) but not timed; their time stays with the deepest timed call.
+ * The hooks keep interrupts disabled for roughly 100-200 cycles, which adds to the ISR latency.
+ */
+
+/* [TAProf.c] END OF FILE */
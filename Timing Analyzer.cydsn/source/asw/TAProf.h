@@ -0,0 +1,127 @@
+/**
+* \file <TAProf.h>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Whole-program function profiler of the Timing Analyzer (-finstrument-functions)
+*
+* With TA_CFG_PROFILER ON this module implements the hooks which gcc calls on entry and exit of
+* every function compiled with -finstrument-functions. They time each call on the DWT cycle
+* counter and build a flat profile (calls, inclusive and exclusive cycles per function address)
+* and a table of caller -> callee edges, without any TA_create in the application. Generated_Source
+* drivers are profiled as well when their files are compiled with the flag.
+*
+* Build options (Project -> Build Settings -> Compiler -> Command Line):
+*
+*   -finstrument-functions -finstrument-functions-exclude-file-list=TimingAnalyzer,TA,LogDma,CyLib,core_cm
+*
+* The exclude list is required: the hooks use the analyzer core, the log ring and
+* CyEnterCriticalSection, and an instrumented callee of a hook would call the hook again.
+*
+*   TA_init();
+*   TAPROF_start();
+*   ...application...
+*   TAPROF_stop();
+*   TAPROF_printStatus();       // PROF lines, symbolized on the host with ta_prof and the .map or .elf
+*
+* Both tables are fixed size; functions and edges which find no free entry are counted as dropped.
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+**/
+
+#ifndef TAPROF_H
+#define TAPROF_H
+
+#include <stdint.h>
+#include "global.h"
+#include "TimingAnalyzer_config.h"
+
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### Defines/Macros
+#if ((TA_CFG_PROF_FUNCS & (TA_CFG_PROF_FUNCS - 1U)) != 0U) || ((TA_CFG_PROF_EDGES & (TA_CFG_PROF_EDGES - 1U)) != 0U)
+#error "TA_CFG_PROF_FUNCS and TA_CFG_PROF_EDGES must be powers of two"
+#endif
+
+/* Keeps a function out of the profile, needed for everything a hook calls */
+#define TAPROF_NO_INSTRUMENT        __attribute__((no_instrument_function))
+
+//####################### Structures
+/**
+* \brief Profile of one function
+*/
+typedef struct {
+    uintptr_t fn;               // Function address as passed by gcc, 0 = free entry
+    uint32_t calls;
+    uint64_t incl;              // Cycles from entry to exit
+    uint64_t excl;              // incl without the calls made by the function
+} TAPROF_Func_t;
+
+/**
+* \brief Calls from one function to another
+*/
+typedef struct {
+    uintptr_t caller;           // 0 for a call on the lowest profiled level
+    uintptr_t callee;           // 0 = free entry
+    uint32_t calls;
+    uint64_t incl;              // Cycles of the callee when called from this caller
+} TAPROF_Edge_t;
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+#if (TA_CFG_PROFILER == ON)
+
+/**
+ * Func to clear the profile. Profiling continues if it is running.
+ * \param None
+ * \return None
+*/
+void TAPROF_reset(void);
+
+/**
+ * Func to calibrate the cost of the hooks, clear the profile and start profiling. Call after TA_init.
+ * \param None
+ * \return None
+*/
+void TAPROF_start(void);
+
+/**
+ * Func to stop profiling, the profile is kept.
+ * \param None
+ * \return None
+*/
+void TAPROF_stop(void);
+
+/**
+ * Func which returns the profile of one function.
+ * \param uintptr_t const fn            : [IN] function address as reported in the PROF FN lines
+ * \param TAPROF_Func_t *const profile  : [OUT] copy of the profile
+ * \return RC_SUCCESS when success, RC_ERROR_NULL when profile is null and RC_ERROR_BAD_PARAM when fn was not profiled
+*/
+RC_t TAPROF_getFunction(uintptr_t const fn, TAPROF_Func_t *const profile);
+
+/**
+ * Func to send the profile over UART as PROF lines for ta_prof. Waits for room in the log ring, main context only.
+ * \param None
+ * \return RC_SUCCESS when success
+*/
+RC_t TAPROF_printStatus(void);
+
+#endif /* TA_CFG_PROFILER */
+
+#endif /* TAPROF_H */
+
+/* [TAProf.h] END OF FILE */
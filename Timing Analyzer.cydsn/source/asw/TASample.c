@@ -0,0 +1,316 @@
+/**
+* \file <TASample.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Statistical sampling profiler of the Timing Analyzer
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "project.h"
+#include "TASample.h"
+#include "TimingAnalyzer.h"
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+#define TASAMPLE_LINE_SIZE          (80U)
+#define TASAMPLE_MASK               (TA_CFG_SAMPLE_SLOTS - 1U)
+#define TASAMPLE_EXC_RETURN         (0xFFFFFFF0UL)      // LR values from here on are EXC_RETURN codes, no code address
+
+#if (TA_CFG_SAMPLER == ON)
+/* Component API by instance name, e.g. TASAMPLE__TIMER(_Start) -> Timer_1ms_1_Start */
+#define TASAMPLE__CAT2(a, b)        a##b
+#define TASAMPLE__CAT(a, b)         TASAMPLE__CAT2(a, b)
+#define TASAMPLE__TIMER(func)       TASAMPLE__CAT(TA_CFG_SAMPLE_TIMER, func)
+#define TASAMPLE__ISR(func)         TASAMPLE__CAT(TA_CFG_SAMPLE_ISR, func)
+
+#define TASAMPLE_PERIOD             ((TA_CFG_SAMPLE_CLOCK_HZ / TA_CFG_SAMPLE_HZ) - 1UL)
+
+#if (TA_CFG_SAMPLE_HZ == 0UL) || (TA_CFG_SAMPLE_HZ > (TA_CFG_SAMPLE_CLOCK_HZ / 2UL))
+#error "TA_CFG_SAMPLE_HZ must be between 1 and half the timer clock"
+#endif
+#endif
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+/* One histogram entry */
+typedef struct {
+    uint32_t key;                   // PC or LR, 0 = free entry
+    uint32_t count;
+} TASAMPLE__Slot_t;
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+static TASAMPLE__Slot_t tasample_g_pc[TA_CFG_SAMPLE_SLOTS];
+static TASAMPLE__Slot_t tasample_g_lr[TA_CFG_SAMPLE_SLOTS];
+static uint32_t tasample_g_by_analyzer[TA_MAX_ANALYZERS];
+static uint32_t tasample_g_total = 0UL;
+static uint32_t tasample_g_lost = 0UL;              // PC values which found no entry within TA_CFG_SAMPLE_PROBES
+static uint32_t tasample_g_unattributed = 0UL;      // Samples while no DWT analyzer was running
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+static boolean_t TASAMPLE__count(TASAMPLE__Slot_t *const table, uint32_t const key);
+static void TASAMPLE__printTable(TASAMPLE__Slot_t const *const table, const char *const tag);
+#if (TA_CFG_SAMPLER == ON)
+static void TASAMPLE__isr(void) __attribute__((naked));
+static void TASAMPLE__tick(uint32_t const *const frame) __attribute__((used));
+#endif
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * Func to clear the histograms and the per analyzer counts.
+ * \param None
+ * \return None
+*/
+void TASAMPLE_reset(void)
+{
+    uint8 intr = CyEnterCriticalSection();
+
+    memset(tasample_g_pc, 0, sizeof(tasample_g_pc));
+    memset(tasample_g_lr, 0, sizeof(tasample_g_lr));
+    memset(tasample_g_by_analyzer, 0, sizeof(tasample_g_by_analyzer));
+    tasample_g_total        = 0UL;
+    tasample_g_lost         = 0UL;
+    tasample_g_unattributed = 0UL;
+
+    CyExitCriticalSection(intr);
+}
+
+/**
+ * Func to count one sample. Called by the sampling ISR with the frame the CPU stacked on exception entry.
+ * \param uint32_t const *const frame   : [IN] stacked exception frame (TASAMPLE_FRAME_PC, TASAMPLE_FRAME_LR)
+ * \return None
+*/
+void TASAMPLE_record(uint32_t const *const frame)
+{
+    uint32_t lr = frame[TASAMPLE_FRAME_LR];
+    TA_t const *const active = TA_getActive();
+
+    tasample_g_total++;
+
+    if (TASAMPLE__count(tasample_g_pc, frame[TASAMPLE_FRAME_PC]) == FALSE)
+    {
+        tasample_g_lost++;
+    }
+
+    // The caller hint is only kept when LR holds a code address   (N2)
+    if (lr < TASAMPLE_EXC_RETURN)
+    {
+        (void)TASAMPLE__count(tasample_g_lr, lr);
+    }
+
+    if ((active != NULL_PTR) && (active->id < TA_MAX_ANALYZERS))
+    {
+        tasample_g_by_analyzer[active->id]++;
+    }
+    else
+    {
+        tasample_g_unattributed++;
+    }
+}
+
+/**
+ * Func which returns the number of samples taken while an analyzer was the innermost running one.
+ * \param uint8_t const id          : [IN] analyzer id
+ * \return samples, 0 for an invalid id
+*/
+uint32_t TASAMPLE_getAnalyzerSamples(uint8_t const id)
+{
+    return (id < TA_MAX_ANALYZERS) ? tasample_g_by_analyzer[id] : 0UL;
+}
+
+/**
+ * Func to send the histograms over UART as SAMPLE lines for ta_prof. Waits for room in the log ring, main context only.
+ * \param None
+ * \return RC_SUCCESS when success
+*/
+RC_t TASAMPLE_printStatus(void)
+{
+    char buffer[TASAMPLE_LINE_SIZE];
+
+    snprintf(buffer, sizeof(buffer), "SAMPLE BEGIN %lu %lu %lu %lu\r\n", (unsigned long)TA_CFG_SAMPLE_HZ,
+        (unsigned long)tasample_g_total, (unsigned long)tasample_g_lost, (unsigned long)tasample_g_unattributed);
+    TA_LOG_STRING_WAIT(buffer);
+
+    TASAMPLE__printTable(tasample_g_pc, "PC");
+    TASAMPLE__printTable(tasample_g_lr, "LR");
+
+    for (uint8_t id = 0U; id < TA_MAX_ANALYZERS; id++)
+    {
+        TA_t const *const analyzer = TA_getAnalyzer(id);
+
+        if ((analyzer != NULL_PTR) && (tasample_g_by_analyzer[id] != 0UL))
+        {
+            snprintf(buffer, sizeof(buffer), "SAMPLE TA %lu %s\r\n", (unsigned long)tasample_g_by_analyzer[id], analyzer->name);
+            TA_LOG_STRING_WAIT(buffer);
+        }
+    }
+
+    TA_LOG_STRING_WAIT("SAMPLE END\r\n");
+
+    return RC_SUCCESS;
+}
+
+#if (TA_CFG_SAMPLER == ON)
+/**
+ * Func to clear the histograms and start the sampling timer and its interrupt. Call after TA_init.
+ * \param None
+ * \return RC_SUCCESS when success
+*/
+RC_t TASAMPLE_start(void)
+{
+    TASAMPLE_reset();
+
+    // Init loads the period of the customizer, so it is overwritten before the timer runs
+    TASAMPLE__TIMER(_Stop)();
+    TASAMPLE__TIMER(_Init)();
+    TASAMPLE__TIMER(_WritePeriod)(TASAMPLE_PERIOD);
+    TASAMPLE__TIMER(_WriteCounter)(TASAMPLE_PERIOD);
+
+    TASAMPLE__ISR(_StartEx)(&TASAMPLE__isr);
+    TASAMPLE__ISR(_SetPriority)(TA_CFG_SAMPLE_PRIORITY);
+
+    TASAMPLE__TIMER(_Enable)();
+
+    return RC_SUCCESS;
+}
+
+/**
+ * Func to stop the sampling timer, the histograms are kept.
+ * \param None
+ * \return None
+*/
+void TASAMPLE_stop(void)
+{
+    TASAMPLE__TIMER(_Stop)();
+    TASAMPLE__ISR(_Stop)();
+}
+
+/**
+ * Func which is the sampling interrupt handler. Naked, so the stack pointer still points to the exception
+ * frame: it takes the frame of the stack which was active (MSP or PSP, bit 2 of EXC_RETURN) and
+ * jumps to TASAMPLE__tick, which returns from the exception.   (N1)
+ * \param None
+ * \return None
+*/
+static void TASAMPLE__isr(void)
+{
+    __asm volatile (
+        "    tst   lr, #4           \n"
+        "    ite   eq               \n"
+        "    mrseq r0, msp          \n"
+        "    mrsne r0, psp          \n"
+        "    b     TASAMPLE__tick   \n"
+    );
+}
+
+/**
+ * Func to acknowledge the timer interrupt and count the sample.
+ * \param uint32_t const *const frame   : [IN] stacked exception frame
+ * \return None
+*/
+static void TASAMPLE__tick(uint32_t const *const frame)
+{
+    (void)TASAMPLE__TIMER(_ReadStatusRegister)();       // Clears the terminal count interrupt
+    TASAMPLE_record(frame);
+}
+#endif
+
+/**
+ * Func to count a key in a histogram. Probes at most TA_CFG_SAMPLE_PROBES entries, so a sample costs a bounded time.
+ * \param TASAMPLE__Slot_t *const table : [IN/OUT] histogram of TA_CFG_SAMPLE_SLOTS entries
+ * \param uint32_t const key            : [IN] PC or LR, not 0
+ * \return TRUE when counted, FALSE when no entry was found
+*/
+static boolean_t TASAMPLE__count(TASAMPLE__Slot_t *const table, uint32_t const key)
+{
+    uint32_t slot = ((key >> 1) * TA_HASH_MUL) >> 16;
+
+    for (uint32_t probe = 0UL; probe < TA_CFG_SAMPLE_PROBES; probe++)
+    {
+        TASAMPLE__Slot_t *const entry = &table[(slot + probe) & TASAMPLE_MASK];
+
+        if (entry->key == key)
+        {
+            entry->count++;
+            return TRUE;
+        }
+        if (entry->key == 0UL)
+        {
+            entry->key   = key;
+            entry->count = 1UL;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * Func to send the used entries of one histogram.
+ * \param TASAMPLE__Slot_t const *const table   : [IN] histogram
+ * \param const char *const tag                 : [IN] "PC" or "LR"
+ * \return None
+*/
+static void TASAMPLE__printTable(TASAMPLE__Slot_t const *const table, const char *const tag)
+{
+    char buffer[TASAMPLE_LINE_SIZE];
+
+    for (uint32_t i = 0UL; i < TA_CFG_SAMPLE_SLOTS; i++)
+    {
+        TASAMPLE__Slot_t entry;
+        uint8 intr = CyEnterCriticalSection();
+
+        entry = table[i];
+        CyExitCriticalSection(intr);
+
+        if (entry.key != 0UL)
+        {
+            snprintf(buffer, sizeof(buffer), "SAMPLE %s 0x%08lx %lu\r\n", tag, (unsigned long)entry.key, (unsigned long)entry.count);
+            TA_LOG_STRING_WAIT(buffer);
+        }
+    }
+}
+
+/* NOTE
+ *
+ * 1. Exception frame - on exception entry the Cortex-M3 pushes r0-r3, r12, lr, pc and xpsr on the
+ * stack which was in use (MSP for ISRs and bare metal main, PSP for RTOS threads). A C handler moves
+ * the stack pointer before its first line, so the frame is taken in a naked handler, where SP is
+ * still the frame address. The handler ends with a plain branch, TASAMPLE__tick returns with the
+ * EXC_RETURN value in LR. At priority 0 it samples other ISRs as well, but not code running under
+ * CyEnterCriticalSection: such a sample is taken at the first instruction after the critical section.
+ *
+ * 2. The stacked LR is the return address of the sampled function only in a leaf function, or before
+ * a non-leaf function has made its first call; otherwise it is whatever the last call left there.
+ * The LR histogram is therefore a hint at the callers of hot leaf functions, not a call graph.
+ * Sampling at a fixed rate can lock onto periodic work with the same period and always hit the same
+ * phase; TA_CFG_SAMPLE_HZ is a prime number for that reason. One sample costs the exception entry
+ * and exit (24 cycles), the status read of the timer and at most TA_CFG_SAMPLE_PROBES probes in
+ * each histogram, about 150 cycles or 0.6% of the CPU at 997 Hz and 24 MHz.
+ */
+
+/* [TASample.c] END OF FILE */
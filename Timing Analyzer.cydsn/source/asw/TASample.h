@@ -0,0 +1,108 @@
+/**
+* \file <TASample.h>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Statistical sampling profiler of the Timing Analyzer
+*
+* A timer interrupt TA_CFG_SAMPLE_HZ times per second reads the program counter and the link
+* register which the CPU has stacked on exception entry, i.e. where the interrupted code was. The
+* values are counted in two small hash histograms, and every sample is also charged to the
+* innermost running DWT analyzer (TA_getActive). No function has to be instrumented and the cost is
+* one short ISR per sample (below 1% CPU at the default rate).
+*
+* Hardware (TA_CFG_SAMPLER ON): place a UDB Timer named TA_CFG_SAMPLE_TIMER with interrupt on
+* terminal count and an isr component TA_CFG_SAMPLE_ISR connected to its interrupt output.
+*
+*   TA_init();
+*   TASAMPLE_start();
+*   ...application...
+*   TASAMPLE_stop();
+*   TASAMPLE_printStatus();     // SAMPLE lines, ranked per function on the host with ta_prof
+*
+* TASAMPLE_record is the hardware independent part, it can also be fed from an own exception handler.
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+**/
+
+#ifndef TASAMPLE_H
+#define TASAMPLE_H
+
+#include "global.h"
+#include "TimingAnalyzer_config.h"
+
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### Defines/Macros
+#if ((TA_CFG_SAMPLE_SLOTS & (TA_CFG_SAMPLE_SLOTS - 1U)) != 0U) || (TA_CFG_SAMPLE_PROBES > TA_CFG_SAMPLE_SLOTS)
+#error "TA_CFG_SAMPLE_SLOTS must be a power of two of at least TA_CFG_SAMPLE_PROBES"
+#endif
+
+/* Words of the exception frame stacked by the CPU: r0, r1, r2, r3, r12, lr, pc, xpsr */
+#define TASAMPLE_FRAME_LR           (5U)
+#define TASAMPLE_FRAME_PC           (6U)
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * Func to clear the histograms and the per analyzer counts.
+ * \param None
+ * \return None
+*/
+void TASAMPLE_reset(void);
+
+/**
+ * Func to count one sample. Called by the sampling ISR with the frame the CPU stacked on exception entry.
+ * \param uint32_t const *const frame   : [IN] stacked exception frame (TASAMPLE_FRAME_PC, TASAMPLE_FRAME_LR)
+ * \return None
+*/
+void TASAMPLE_record(uint32_t const *const frame);
+
+/**
+ * Func which returns the number of samples taken while an analyzer was the innermost running one.
+ * \param uint8_t const id          : [IN] analyzer id
+ * \return samples, 0 for an invalid id
+*/
+uint32_t TASAMPLE_getAnalyzerSamples(uint8_t const id);
+
+/**
+ * Func to send the histograms over UART as SAMPLE lines for ta_prof. Waits for room in the log ring, main context only.
+ * \param None
+ * \return RC_SUCCESS when success
+*/
+RC_t TASAMPLE_printStatus(void);
+
+#if (TA_CFG_SAMPLER == ON)
+
+/**
+ * Func to clear the histograms and start the sampling timer and its interrupt. Call after TA_init.
+ * \param None
+ * \return RC_SUCCESS when success
+*/
+RC_t TASAMPLE_start(void);
+
+/**
+ * Func to stop the sampling timer, the histograms are kept.
+ * \param None
+ * \return None
+*/
+void TASAMPLE_stop(void);
+
+#endif /* TA_CFG_SAMPLER */
+
+#endif /* TASAMPLE_H */
+
+/* [TASample.h] END OF FILE */
@@ -0,0 +1,321 @@
+/**
+* \file <TATrace.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Lock-free trace ring buffer of the Timing Analyzer
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include <stdio.h>
+#include "project.h"
+#include "TATrace.h"
+#include "TimingAnalyzer.h"
+#include "UART_LOG.h"
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+#define TATRACE_MASK               (TA_CFG_TRACE_SIZE - 1UL)
+#define TATRACE_COMMITTED          (1U)
+#define TATRACE_FREE               (0U)
+#define TATRACE_LINE_SIZE          (80U)
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+/* One ring slot, the event plus its commit flag in 8 byte */
+typedef struct {
+    uint32_t timestamp;
+    uint8_t id;
+    uint8_t type;
+    uint8_t ctx;
+    uint8_t commit;             // TATRACE_COMMITTED once the writer has filled the slot   (N2)
+} TATRACE__Slot_t;
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+static TATRACE__Slot_t ta_g_trace_ring[TA_CFG_TRACE_SIZE];
+static uint32_t ta_g_trace_head = 0UL;      // Next slot to reserve, free running, written by all producers    (N1)
+static uint32_t ta_g_trace_tail = 0UL;      // Next slot to read, free running, written by the consumer only
+static uint32_t ta_g_trace_dropped = 0UL;
+static uint8_t ta_g_trace_created[TA_MAX_ANALYZERS];    // CREATE events per id still in the ring   (N4)
+
+static const char *const ta_g_trace_names[TATRACE_EVT_COUNT] = { "START", "PAUSE", "RESUME", "STOP", "PIN_HI", "PIN_LO", "CREATE" };
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+static const char *TATRACE__name(uint8_t const id);
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * Func to append an event to the ring. Callable from any context, never blocks, never disables interrupts.
+ * \param uint8_t const id              : [IN] analyzer id
+ * \param TA_TraceType_t const type     : [IN] event type
+ * \return RC_SUCCESS when recorded, RC_ERROR_BAD_PARAM for TA_ID_NONE and RC_ERROR_BUFFER_FULL when the event was dropped
+*/
+RC_t TATRACE_record(uint8_t const id, TA_TraceType_t const type)
+{
+    uint32_t head = __atomic_load_n(&ta_g_trace_head, __ATOMIC_RELAXED);
+    uint32_t timestamp;
+    TATRACE__Slot_t *slot;
+
+    // Unregistered analyzers (e.g. the calibration probe) are not traced
+    if (id == TA_ID_NONE)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+
+    // Counted before the event is visible, so the consumer never counts below zero   (N4)
+    if ((type == TATRACE_EVT_CREATE) && (id < TA_MAX_ANALYZERS))
+    {
+        (void)__atomic_fetch_add(&ta_g_trace_created[id], 1U, __ATOMIC_RELAXED);
+    }
+
+    // Reserve a slot, retried when an interrupt recorded in between      (N1)
+    do {
+        if ((head - __atomic_load_n(&ta_g_trace_tail, __ATOMIC_ACQUIRE)) >= TA_CFG_TRACE_SIZE)
+        {
+            if ((type == TATRACE_EVT_CREATE) && (id < TA_MAX_ANALYZERS))
+            {
+                (void)__atomic_fetch_sub(&ta_g_trace_created[id], 1U, __ATOMIC_RELAXED);
+            }
+            (void)__atomic_fetch_add(&ta_g_trace_dropped, 1UL, __ATOMIC_RELAXED);
+            return RC_ERROR_BUFFER_FULL;
+        }
+        // Timestamp inside the loop, so the ring order is the timestamp order
+        timestamp = DWT->CYCCNT;
+    } while (!__atomic_compare_exchange_n(&ta_g_trace_head, &head, head + 1UL, TRUE, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+    // Slot is ours, fill and publish it
+    slot            = &ta_g_trace_ring[head & TATRACE_MASK];
+    slot->timestamp = timestamp;
+    slot->id        = id;
+    slot->type      = (uint8_t)type;
+    slot->ctx       = (uint8_t)__get_IPSR();
+    __atomic_store_n(&slot->commit, TATRACE_COMMITTED, __ATOMIC_RELEASE);
+
+    return RC_SUCCESS;
+}
+
+/**
+ * Func to take the oldest event out of the ring. Single consumer, e.g. the main loop.
+ * \param TA_TraceEvent_t *const event  : [OUT] oldest event
+ * \return RC_SUCCESS when an event was read, RC_ERROR_NULL when the event pointer is null,
+ *         RC_ERROR_BUFFER_EMTPY when the ring is empty and
+ *         RC_ERROR_BUSY when the oldest slot is reserved but its writer was preempted (retry later)
+*/
+RC_t TATRACE_read(TA_TraceEvent_t *const event)
+{
+    uint32_t tail = ta_g_trace_tail;
+    TATRACE__Slot_t *slot;
+
+    if (event == NULL_PTR)
+    {
+        return RC_ERROR_NULL;
+    }
+
+    if (tail == __atomic_load_n(&ta_g_trace_head, __ATOMIC_ACQUIRE))
+    {
+        return RC_ERROR_BUFFER_EMTPY;
+    }
+
+    slot = &ta_g_trace_ring[tail & TATRACE_MASK];
+    if (__atomic_load_n(&slot->commit, __ATOMIC_ACQUIRE) != TATRACE_COMMITTED)
+    {
+        return RC_ERROR_BUSY;
+    }
+
+    event->timestamp = slot->timestamp;
+    event->id        = slot->id;
+    event->type      = slot->type;
+    event->ctx       = slot->ctx;
+
+    if ((event->type == TATRACE_EVT_CREATE) && (event->id < TA_MAX_ANALYZERS))
+    {
+        (void)__atomic_fetch_sub(&ta_g_trace_created[event->id], 1U, __ATOMIC_RELAXED);
+    }
+
+    // Free the slot before handing it back to the producers
+    slot->commit = TATRACE_FREE;
+    __atomic_store_n(&ta_g_trace_tail, tail + 1UL, __ATOMIC_RELEASE);
+
+    return RC_SUCCESS;
+}
+
+/**
+ * Func which returns the number of events waiting in the ring (including reserved ones).
+ * \param None
+ * \return number of events
+*/
+uint32_t TATRACE_getCount(void)
+{
+    return __atomic_load_n(&ta_g_trace_head, __ATOMIC_ACQUIRE) - ta_g_trace_tail;
+}
+
+/**
+ * Func which returns the number of events lost because the ring was full.
+ * \param None
+ * \return number of dropped events since TA_init
+*/
+uint32_t TATRACE_getDropped(void)
+{
+    return __atomic_load_n(&ta_g_trace_dropped, __ATOMIC_RELAXED);
+}
+
+/**
+ * Func to drain the ring and send the events over UART as text, one line per event.
+ * \param None
+ * \return RC_SUCCESS when success and RC_ERROR_BUFFER_EMTPY when there was nothing to print
+*/
+RC_t TATRACE_printAll(void)
+{
+    char buffer[TATRACE_LINE_SIZE];
+    TA_TraceEvent_t event;
+    boolean_t any = FALSE;
+
+    while (TATRACE_read(&event) == RC_SUCCESS)
+    {
+        const char *const name = TATRACE__name(event.id);
+
+        snprintf(buffer, sizeof(buffer), "Trace: %10lu | %-6s | ctx %3u | %s\r\n", (unsigned long)event.timestamp,
+            (event.type < TATRACE_EVT_COUNT) ? ta_g_trace_names[event.type] : "?", event.ctx,
+            (name != NULL_PTR) ? name : "<deleted>");
+        TA_LOG_STRING(buffer);
+        any = TRUE;
+    }
+
+    if (TATRACE_getDropped() != 0UL)
+    {
+        snprintf(buffer, sizeof(buffer), "Trace: %lu events dropped\r\n", (unsigned long)TATRACE_getDropped());
+        TA_LOG_STRING(buffer);
+    }
+
+    return (any == TRUE) ? RC_SUCCESS : RC_ERROR_BUFFER_EMTPY;
+}
+
+/**
+ * Func to drain the ring and send the events as binary frames (TAWire.h), the compact counterpart of TATRACE_printAll.
+ * The name of every analyzer is sent once per call ahead of its first event.   (N3)
+ * \param None
+ * \return RC_SUCCESS when success and RC_ERROR_BUFFER_EMTPY when there was nothing to send
+*/
+RC_t TATRACE_sendAll(void)
+{
+    uint8_t payload[TA_CFG_WIRE_FRAME_SIZE];
+    uint32_t announced[(TA_MAX_ANALYZERS + 31U) / 32U] = { 0UL };
+    TA_WireFrame_t frame;
+    TA_TraceEvent_t event;
+    boolean_t any = FALSE;
+
+    (void)TAWIRE_begin(&frame, payload, sizeof(payload));
+
+    while (TATRACE_read(&event) == RC_SUCCESS)
+    {
+        // A new analyzer behind this id, its name follows
+        if ((event.type == TATRACE_EVT_CREATE) && (event.id < TA_MAX_ANALYZERS))
+        {
+            announced[event.id >> 5] &= ~(1UL << (event.id & 31U));
+        }
+
+        if ((event.id < TA_MAX_ANALYZERS) && ((announced[event.id >> 5] & (1UL << (event.id & 31U))) == 0UL))
+        {
+            const char *const name = TATRACE__name(event.id);
+
+            // No name for the events of a deleted analyzer, the host keeps the one it got before   (N4)
+            if ((name != NULL_PTR) && (TAWIRE_putName(&frame, event.id, name) != RC_SUCCESS))
+            {
+                (void)TA_sendFrame(&frame);
+                (void)TAWIRE_putName(&frame, event.id, name);
+            }
+            announced[event.id >> 5] |= 1UL << (event.id & 31U);
+        }
+
+        // Frame full - send it and start the next one with this event
+        if (TAWIRE_putEvent(&frame, &event) != RC_SUCCESS)
+        {
+            (void)TA_sendFrame(&frame);
+            (void)TAWIRE_putEvent(&frame, &event);
+        }
+        any = TRUE;
+    }
+
+    if (TATRACE_getDropped() != 0UL)
+    {
+        if (TAWIRE_putDropped(&frame, TATRACE_getDropped()) != RC_SUCCESS)
+        {
+            (void)TA_sendFrame(&frame);
+            (void)TAWIRE_putDropped(&frame, TATRACE_getDropped());
+        }
+    }
+
+    (void)TA_sendFrame(&frame);
+
+    return (any == TRUE) ? RC_SUCCESS : RC_ERROR_BUFFER_EMTPY;
+}
+
+/**
+ * Func which returns the name of the analyzer an event just read belongs to.
+ * \param uint8_t const id              : [IN] analyzer id of the event
+ * \return name, NULL_PTR when the analyzer was deleted (its id may be used by a newer one)
+*/
+static const char *TATRACE__name(uint8_t const id)
+{
+    TA_t const *const analyzer = TA_getAnalyzer(id);
+
+    if ((analyzer == NULL_PTR) || (__atomic_load_n(&ta_g_trace_created[id], __ATOMIC_RELAXED) != 0U))
+    {
+        return NULL_PTR;
+    }
+    return analyzer->name;
+}
+
+/* NOTE
+ *
+ * 1. Multi producer / single consumer ring. Producers (any ISR level and the main loop) reserve a
+ * slot by moving head with compare-and-swap, which GCC compiles to LDREX/STREX on the Cortex-M3.
+ * Every exception entry/return clears the exclusive monitor, so a producer that got preempted by
+ * another producer fails its STREX and simply retries - no interrupt lock needed. head and tail are
+ * free running, head - tail is the fill level (unsigned arithmetic covers the wrap).
+ *
+ * 2. Between reservation and commit a slot is reserved but not yet valid. When a low priority
+ * writer is preempted in this window, the consumer sees the slot without commit flag and stops
+ * (RC_ERROR_BUSY) instead of reading half written data. The consumer clears the flag before it
+ * advances tail, so a slot can only be reserved again once it is free.
+ *
+ * 3. Events only carry the analyzer id. Announcing the names in the same stream lets a host tool
+ * (ta_decode, ta_convert) label events while it reads, even when the capture starts in the middle
+ * of a session and no TA_sendAll was seen yet. A name costs about 2 + length bytes per analyzer
+ * and call, which is small against the events of a typical drain.
+ *
+ * 4. Id reuse - TA_delete hands the id to the next TA_create, while events of the old analyzer may
+ * still wait in the ring. The drain only knows the current owner of an id, so every create records a
+ * CREATE event and ta_g_trace_created counts those not read yet. As long as one is left for an id,
+ * the event in hand is older than the current owner and its name is unknown. The text drain prints
+ * <deleted>; the binary drain sends no NAME, so the host keeps the name of an earlier drain, and
+ * announces the new name behind the CREATE event.
+ */
+
+/* [TATrace.c] END OF FILE */
@@ -0,0 +1,135 @@
+/**
+* \file <TATrace.h>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Lock-free trace ring buffer of the Timing Analyzer
+*
+* TA_start, TA_pause, TA_resume and TA_stop append an event (analyzer id, event type, exception
+* context, DWT timestamp) to a fixed RAM ring. Recording is safe from any ISR priority without
+* disabling interrupts: slots are reserved with LDREX/STREX and published with a commit flag.
+* One consumer (main loop) drains the ring with TATRACE_read, so complete timelines including
+* preemptions can be rebuilt offline. A full ring drops new events and counts them.
+*
+* The inline macros of TimingAnalyzer_fast.h do not record events.
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+**/
+
+#ifndef TATRACE_H
+#define TATRACE_H
+
+#include "global.h"
+#include "TimingAnalyzer_config.h"
+
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### Defines/Macros
+#if ((TA_CFG_TRACE_SIZE & (TA_CFG_TRACE_SIZE - 1UL)) != 0UL)
+#error "TA_CFG_TRACE_SIZE must be a power of two"
+#endif
+
+/* Hooks used by TimingAnalyzer.c, compiled out with TA_CFG_TRACE OFF (and TA_CFG_PIN_EDGES OFF) */
+#if (TA_CFG_TRACE == ON)
+#define TATRACE_RECORD(id, type)    TATRACE_record((id), (type))
+#else
+#define TATRACE_RECORD(id, type)
+#endif
+
+#if (TA_CFG_TRACE == ON) && (TA_CFG_PIN_EDGES == ON)
+#define TATRACE_RECORD_EDGE(id, type)   TATRACE_record((id), (type))
+#else
+#define TATRACE_RECORD_EDGE(id, type)
+#endif
+
+//####################### Enumerations
+/**
+* \Trace event type enum
+*/
+typedef enum {
+    TATRACE_EVT_START,          /**< \TA_start */
+    TATRACE_EVT_PAUSE,          /**< \TA_pause */
+    TATRACE_EVT_RESUME,         /**< \TA_resume */
+    TATRACE_EVT_STOP,           /**< \TA_stop */
+    TATRACE_EVT_PIN_HIGH,       /**< \Pin set by the runtime API of a pin mode (TA_CFG_PIN_EDGES) */
+    TATRACE_EVT_PIN_LOW,        /**< \Pin cleared by the runtime API of a pin mode (TA_CFG_PIN_EDGES) */
+    TATRACE_EVT_CREATE,         /**< \TA_create, the id belongs to a new analyzer from here on */
+    TATRACE_EVT_COUNT
+} TA_TraceType_t;
+
+//####################### Structures
+/**
+* \Trace event struct
+*/
+typedef struct {
+    uint32_t timestamp;         // DWT->CYCCNT when the event was recorded
+    uint8_t id;                 // Analyzer id, see TA_getAnalyzer
+    uint8_t type;               // TA_TraceType_t
+    uint8_t ctx;                // Exception number (IPSR) of the caller, 0 = thread mode
+} TA_TraceEvent_t;
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * Func to append an event to the ring. Callable from any context, never blocks, never disables interrupts.
+ * \param uint8_t const id              : [IN] analyzer id
+ * \param TA_TraceType_t const type     : [IN] event type
+ * \return RC_SUCCESS when recorded, RC_ERROR_BAD_PARAM for TA_ID_NONE and RC_ERROR_BUFFER_FULL when the event was dropped
+*/
+RC_t TATRACE_record(uint8_t const id, TA_TraceType_t const type);
+
+/**
+ * Func to take the oldest event out of the ring. Single consumer, e.g. the main loop.
+ * \param TA_TraceEvent_t *const event  : [OUT] oldest event
+ * \return RC_SUCCESS when an event was read, RC_ERROR_NULL when the event pointer is null,
+ *         RC_ERROR_BUFFER_EMTPY when the ring is empty and
+ *         RC_ERROR_BUSY when the oldest slot is reserved but its writer was preempted (retry later)
+*/
+RC_t TATRACE_read(TA_TraceEvent_t *const event);
+
+/**
+ * Func which returns the number of events waiting in the ring (including reserved ones).
+ * \param None
+ * \return number of events
+*/
+uint32_t TATRACE_getCount(void);
+
+/**
+ * Func which returns the number of events lost because the ring was full.
+ * \param None
+ * \return number of dropped events since TA_init
+*/
+uint32_t TATRACE_getDropped(void);
+
+/**
+ * Func to drain the ring and send the events over UART as text, one line per event.
+ * Events of an analyzer which was deleted since are printed as <deleted>, also when its id was reused.
+ * \param None
+ * \return RC_SUCCESS when success and RC_ERROR_BUFFER_EMTPY when there was nothing to print
+*/
+RC_t TATRACE_printAll(void);
+
+/**
+ * Func to drain the ring and send the events as binary frames (TAWire.h), the compact counterpart of TATRACE_printAll.
+ * The name of every analyzer is sent once per call ahead of its first event and again behind a CREATE event.
+ * \param None
+ * \return RC_SUCCESS when success and RC_ERROR_BUFFER_EMTPY when there was nothing to send
+*/
+RC_t TATRACE_sendAll(void);
+
+#endif /* TATRACE_H */
+
+/* [TATrace.h] END OF FILE */
@@ -0,0 +1,562 @@
+/**
+* \file <TAWire.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Binary wire format of the Timing Analyzer (encoder and decoder)
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include <string.h>
+#include "TAWire.h"
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+#define TAWIRE_RECORD_MAX          (TAWIRE_NAME_MAX + 3U)   // Largest record: tag, id, length, name
+#define TAWIRE_EVENT_MAX           (3U + TAWIRE_VARINT_MAX) // Event record: tag, id, ctx, delta
+#define TAWIRE_VARINT_MORE         (0x80U)                  // Continuation bit of a LEB128 byte
+#define TAWIRE_VARINT_BITS         (0x7FU)
+#define TAWIRE_MODE_SHIFT          (4U)                     // STATS: mode in the upper, state in the lower nibble
+#define TAWIRE_STATE_MASK          (0x0FU)
+#define TAWIRE_COBS_MAX_CODE       (0xFFU)                  // 254 data bytes without a zero
+#define TAWIRE_CRC_INIT            (0xFFFFU)
+
+/*****************************************************************************/
+/* Global variable definitions (declared in header file with 'extern')       */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local type definitions ('typedef')                                        */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+/* CRC-16/CCITT of every byte value, one lookup per byte on the hot path of the stream */
+static const uint16_t ta_g_crc_table[256] = {
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+    0x1231U, 0x0210U, 0x3273U, 0x2252U, 0x52B5U, 0x4294U, 0x72F7U, 0x62D6U,
+    0x9339U, 0x8318U, 0xB37BU, 0xA35AU, 0xD3BDU, 0xC39CU, 0xF3FFU, 0xE3DEU,
+    0x2462U, 0x3443U, 0x0420U, 0x1401U, 0x64E6U, 0x74C7U, 0x44A4U, 0x5485U,
+    0xA56AU, 0xB54BU, 0x8528U, 0x9509U, 0xE5EEU, 0xF5CFU, 0xC5ACU, 0xD58DU,
+    0x3653U, 0x2672U, 0x1611U, 0x0630U, 0x76D7U, 0x66F6U, 0x5695U, 0x46B4U,
+    0xB75BU, 0xA77AU, 0x9719U, 0x8738U, 0xF7DFU, 0xE7FEU, 0xD79DU, 0xC7BCU,
+    0x48C4U, 0x58E5U, 0x6886U, 0x78A7U, 0x0840U, 0x1861U, 0x2802U, 0x3823U,
+    0xC9CCU, 0xD9EDU, 0xE98EU, 0xF9AFU, 0x8948U, 0x9969U, 0xA90AU, 0xB92BU,
+    0x5AF5U, 0x4AD4U, 0x7AB7U, 0x6A96U, 0x1A71U, 0x0A50U, 0x3A33U, 0x2A12U,
+    0xDBFDU, 0xCBDCU, 0xFBBFU, 0xEB9EU, 0x9B79U, 0x8B58U, 0xBB3BU, 0xAB1AU,
+    0x6CA6U, 0x7C87U, 0x4CE4U, 0x5CC5U, 0x2C22U, 0x3C03U, 0x0C60U, 0x1C41U,
+    0xEDAEU, 0xFD8FU, 0xCDECU, 0xDDCDU, 0xAD2AU, 0xBD0BU, 0x8D68U, 0x9D49U,
+    0x7E97U, 0x6EB6U, 0x5ED5U, 0x4EF4U, 0x3E13U, 0x2E32U, 0x1E51U, 0x0E70U,
+    0xFF9FU, 0xEFBEU, 0xDFDDU, 0xCFFCU, 0xBF1BU, 0xAF3AU, 0x9F59U, 0x8F78U,
+    0x9188U, 0x81A9U, 0xB1CAU, 0xA1EBU, 0xD10CU, 0xC12DU, 0xF14EU, 0xE16FU,
+    0x1080U, 0x00A1U, 0x30C2U, 0x20E3U, 0x5004U, 0x4025U, 0x7046U, 0x6067U,
+    0x83B9U, 0x9398U, 0xA3FBU, 0xB3DAU, 0xC33DU, 0xD31CU, 0xE37FU, 0xF35EU,
+    0x02B1U, 0x1290U, 0x22F3U, 0x32D2U, 0x4235U, 0x5214U, 0x6277U, 0x7256U,
+    0xB5EAU, 0xA5CBU, 0x95A8U, 0x8589U, 0xF56EU, 0xE54FU, 0xD52CU, 0xC50DU,
+    0x34E2U, 0x24C3U, 0x14A0U, 0x0481U, 0x7466U, 0x6447U, 0x5424U, 0x4405U,
+    0xA7DBU, 0xB7FAU, 0x8799U, 0x97B8U, 0xE75FU, 0xF77EU, 0xC71DU, 0xD73CU,
+    0x26D3U, 0x36F2U, 0x0691U, 0x16B0U, 0x6657U, 0x7676U, 0x4615U, 0x5634U,
+    0xD94CU, 0xC96DU, 0xF90EU, 0xE92FU, 0x99C8U, 0x89E9U, 0xB98AU, 0xA9ABU,
+    0x5844U, 0x4865U, 0x7806U, 0x6827U, 0x18C0U, 0x08E1U, 0x3882U, 0x28A3U,
+    0xCB7DU, 0xDB5CU, 0xEB3FU, 0xFB1EU, 0x8BF9U, 0x9BD8U, 0xABBBU, 0xBB9AU,
+    0x4A75U, 0x5A54U, 0x6A37U, 0x7A16U, 0x0AF1U, 0x1AD0U, 0x2AB3U, 0x3A92U,
+    0xFD2EU, 0xED0FU, 0xDD6CU, 0xCD4DU, 0xBDAAU, 0xAD8BU, 0x9DE8U, 0x8DC9U,
+    0x7C26U, 0x6C07U, 0x5C64U, 0x4C45U, 0x3CA2U, 0x2C83U, 0x1CE0U, 0x0CC1U,
+    0xEF1FU, 0xFF3EU, 0xCF5DU, 0xDF7CU, 0xAF9BU, 0xBFBAU, 0x8FD9U, 0x9FF8U,
+    0x6E17U, 0x7E36U, 0x4E55U, 0x5E74U, 0x2E93U, 0x3EB2U, 0x0ED1U, 0x1EF0U
+};
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+static uint16_t TAWIRE__putVarint(uint8_t *const out, uint16_t pos, uint32_t value);
+static RC_t TAWIRE__append(TA_WireFrame_t *const me, uint8_t const *const record, uint16_t const length);
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * Func to start a new empty frame.
+ * \param TA_WireFrame_t *const me  : [OUT] frame
+ * \param uint8_t *const buffer     : [IN] payload memory, at least TAWIRE_CRC_SIZE larger than the records
+ * \param uint16_t const size       : [IN] size of buffer
+ * \return RC_SUCCESS when success, RC_ERROR_NULL when a pointer param is null
+*/
+RC_t TAWIRE_begin(TA_WireFrame_t *const me, uint8_t *const buffer, uint16_t const size)
+{
+    if ((me == NULL_PTR) || (buffer == NULL_PTR))
+    {
+        return RC_ERROR_NULL;
+    }
+
+    me->buffer         = buffer;
+    me->size           = size;
+    me->length         = 0U;
+    me->last_timestamp = 0UL;
+    me->has_timestamp  = FALSE;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * Func to append a trace event record.
+ * \param TA_WireFrame_t *const me              : [IN/OUT] frame
+ * \param TA_TraceEvent_t const *const event    : [IN] event
+ * \return RC_SUCCESS when success and RC_ERROR_BUFFER_FULL when the frame has no room (frame unchanged)
+*/
+RC_t TAWIRE_putEvent(TA_WireFrame_t *const me, TA_TraceEvent_t const *const event)
+{
+    uint16_t pos = me->length;
+    uint32_t delta;
+
+    // Hot path of the trace stream: written in place, room for the longest possible record is required
+    if ((uint32_t)pos + TAWIRE_EVENT_MAX + TAWIRE_CRC_SIZE > me->size)
+    {
+        return RC_ERROR_BUFFER_FULL;
+    }
+
+    // First event of the frame absolute, then the distance to the previous one     (N1)
+    delta = (me->has_timestamp == TRUE) ? (event->timestamp - me->last_timestamp) : event->timestamp;
+
+    me->buffer[pos++] = (uint8_t)(TAWIRE_TAG_EVENT + event->type);
+    me->buffer[pos++] = event->id;
+    me->buffer[pos++] = event->ctx;
+    me->length = TAWIRE__putVarint(me->buffer, pos, delta);
+
+    me->last_timestamp = event->timestamp;
+    me->has_timestamp  = TRUE;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * Func to append a name announcement record.
+ * \param TA_WireFrame_t *const me  : [IN/OUT] frame
+ * \param uint8_t const id          : [IN] analyzer id
+ * \param const char *const name    : [IN] analyzer name, cut to TAWIRE_NAME_MAX
+ * \return RC_SUCCESS when success and RC_ERROR_BUFFER_FULL when the frame has no room (frame unchanged)
+*/
+RC_t TAWIRE_putName(TA_WireFrame_t *const me, uint8_t const id, const char *const name)
+{
+    uint8_t record[TAWIRE_RECORD_MAX];
+    uint16_t pos = 0U;
+    size_t length = strlen(name);
+
+    if (length > TAWIRE_NAME_MAX)
+    {
+        length = TAWIRE_NAME_MAX;
+    }
+
+    record[pos++] = (uint8_t)TAWIRE_TAG_NAME;
+    record[pos++] = id;
+    record[pos++] = (uint8_t)length;
+    memcpy(&record[pos], name, length);
+    pos += (uint16_t)length;
+
+    return TAWIRE__append(me, record, pos);
+}
+
+/**
+ * Func to append a statistics record.
+ * \param TA_WireFrame_t *const me              : [IN/OUT] frame
+ * \param TA_WireStats_t const *const stats     : [IN] statistics
+ * \return RC_SUCCESS when success and RC_ERROR_BUFFER_FULL when the frame has no room (frame unchanged)
+*/
+RC_t TAWIRE_putStats(TA_WireFrame_t *const me, TA_WireStats_t const *const stats)
+{
+    uint8_t record[TAWIRE_RECORD_MAX];
+    uint16_t pos = 0U;
+
+    record[pos++] = (uint8_t)TAWIRE_TAG_STATS;
+    record[pos++] = stats->id;
+    record[pos++] = (uint8_t)((stats->mode << TAWIRE_MODE_SHIFT) | (stats->state & TAWIRE_STATE_MASK));
+    pos = TAWIRE__putVarint(record, pos, stats->elapsed);
+    pos = TAWIRE__putVarint(record, pos, stats->count);
+    pos = TAWIRE__putVarint(record, pos, stats->min);
+    pos = TAWIRE__putVarint(record, pos, stats->max - stats->min);     // Run times are close to each other   (N3)
+    pos = TAWIRE__putVarint(record, pos, stats->mean - stats->min);
+    pos = TAWIRE__putVarint(record, pos, stats->stddev);
+
+    return TAWIRE__append(me, record, pos);
+}
+
+/**
+ * Func to append a dropped events record.
+ * \param TA_WireFrame_t *const me  : [IN/OUT] frame
+ * \param uint32_t const dropped    : [IN] number of lost trace events
+ * \return RC_SUCCESS when success and RC_ERROR_BUFFER_FULL when the frame has no room (frame unchanged)
+*/
+RC_t TAWIRE_putDropped(TA_WireFrame_t *const me, uint32_t const dropped)
+{
+    uint8_t record[TAWIRE_RECORD_MAX];
+    uint16_t pos = 0U;
+
+    record[pos++] = (uint8_t)TAWIRE_TAG_DROPPED;
+    pos = TAWIRE__putVarint(record, pos, dropped);
+
+    return TAWIRE__append(me, record, pos);
+}
+
+/**
+ * Func to close a frame: appends the CRC and writes the COBS encoded frame including the delimiter.
+ * \param TA_WireFrame_t *const me  : [IN/OUT] frame, empty afterwards
+ * \param uint8_t *const out        : [OUT] encoded frame
+ * \param uint16_t const size       : [IN] size of out, TAWIRE_ENCODED_SIZE(payload + TAWIRE_CRC_SIZE) is always enough
+ * \return number of bytes written to out, 0 for an empty frame or when out is too small
+*/
+uint16_t TAWIRE_finish(TA_WireFrame_t *const me, uint8_t *const out, uint16_t const size)
+{
+    uint16_t length = me->length;
+    uint16_t crc;
+    uint16_t read = 0U;
+    uint16_t write = 1U;
+    uint16_t code_pos = 0U;
+    uint8_t code = 1U;
+
+    if ((length == 0U) || (size < TAWIRE_ENCODED_SIZE(length + TAWIRE_CRC_SIZE)))
+    {
+        return 0U;
+    }
+
+    // CRC little endian behind the records (room is reserved by TAWIRE__append)
+    crc = TAWIRE_crc16(me->buffer, length);
+    me->buffer[length++] = (uint8_t)(crc & 0xFFU);
+    me->buffer[length++] = (uint8_t)(crc >> 8U);
+
+    // COBS: every zero is replaced by the distance to the next one      (N2)
+    while (read < length)
+    {
+        if (me->buffer[read] == 0U)
+        {
+            out[code_pos] = code;
+            code          = 1U;
+            code_pos      = write++;
+        }
+        else
+        {
+            out[write++] = me->buffer[read];
+            code++;
+            if (code == TAWIRE_COBS_MAX_CODE)
+            {
+                out[code_pos] = code;
+                code          = 1U;
+                code_pos      = write++;
+            }
+        }
+        read++;
+    }
+    out[code_pos] = code;
+    out[write++]  = TAWIRE_DELIMITER;
+
+    // Ready for the next frame
+    me->length        = 0U;
+    me->has_timestamp = FALSE;
+
+    return write;
+}
+
+/**
+ * Func to decode one received frame (without delimiter) in place: COBS decoding and CRC check.
+ * \param uint8_t *const frame      : [IN/OUT] received bytes, records afterwards
+ * \param uint16_t const length     : [IN] number of received bytes
+ * \param uint16_t *const records   : [OUT] length of the records without CRC
+ * \return RC_SUCCESS when success, RC_ERROR_NULL when a pointer param is null and
+ *         RC_ERROR_BAD_PARAM when the frame is corrupted (COBS or CRC error)
+*/
+RC_t TAWIRE_decode(uint8_t *const frame, uint16_t const length, uint16_t *const records)
+{
+    uint16_t read = 0U;
+    uint16_t write = 0U;
+    uint16_t crc;
+
+    if ((frame == NULL_PTR) || (records == NULL_PTR))
+    {
+        return RC_ERROR_NULL;
+    }
+
+    // COBS, in place is safe as the output is always shorter than the input
+    while (read < length)
+    {
+        uint8_t code = frame[read++];
+
+        if (code == 0U)
+        {
+            return RC_ERROR_BAD_PARAM;
+        }
+        for (uint8_t i = 1U; i < code; i++)
+        {
+            if (read >= length)
+            {
+                return RC_ERROR_BAD_PARAM;
+            }
+            frame[write++] = frame[read++];
+        }
+        if ((code < TAWIRE_COBS_MAX_CODE) && (read < length))
+        {
+            frame[write++] = 0U;
+        }
+    }
+
+    if (write < TAWIRE_CRC_SIZE)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+
+    write = write - TAWIRE_CRC_SIZE;
+    crc   = (uint16_t)frame[write] | (uint16_t)((uint16_t)frame[write + 1U] << 8U);
+    if (crc != TAWIRE_crc16(frame, write))
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+
+    *records = write;
+    return RC_SUCCESS;
+}
+
+/**
+ * Func to start reading the records of a frame checked by TAWIRE_decode.
+ * \param TA_WireReader_t *const me         : [OUT] reader
+ * \param uint8_t const *const records      : [IN] records
+ * \param uint16_t const length             : [IN] length of the records
+ * \return RC_SUCCESS when success, RC_ERROR_NULL when a pointer param is null
+*/
+RC_t TAWIRE_readBegin(TA_WireReader_t *const me, uint8_t const *const records, uint16_t const length)
+{
+    if ((me == NULL_PTR) || (records == NULL_PTR))
+    {
+        return RC_ERROR_NULL;
+    }
+
+    me->data      = records;
+    me->length    = length;
+    me->pos       = 0U;
+    me->has_event = FALSE;
+
+    return RC_SUCCESS;
+}
+
+/**
+ * Func to read the next record. The host tools use it, so all of them follow the record layout of this file.
+ * \param TA_WireReader_t *const me         : [IN/OUT] reader
+ * \param TA_WireRecord_t *const record     : [OUT] record
+ * \return RC_SUCCESS when a record was read, RC_ERROR_BUFFER_EMTPY behind the last one and
+ *         RC_ERROR_BAD_PARAM for a truncated record or an unknown tag (the rest of the frame can not be read)
+*/
+RC_t TAWIRE_readNext(TA_WireReader_t *const me, TA_WireRecord_t *const record)
+{
+    uint8_t const *const data = me->data;
+    uint16_t const length = me->length;
+    uint16_t pos = me->pos;
+    uint8_t tag;
+
+    if (pos >= length)
+    {
+        return RC_ERROR_BUFFER_EMTPY;
+    }
+    tag = data[pos++];
+
+    if ((tag >= (uint8_t)TAWIRE_TAG_EVENT) && (tag < ((uint8_t)TAWIRE_TAG_EVENT + (uint8_t)TATRACE_EVT_COUNT)))
+    {
+        if ((pos + 2U) > length)
+        {
+            return RC_ERROR_BAD_PARAM;
+        }
+        record->tag  = TAWIRE_TAG_EVENT;
+        record->type = tag - (uint8_t)TAWIRE_TAG_EVENT;
+        record->id   = data[pos++];
+        record->ctx  = data[pos++];
+        if (TAWIRE_getVarint(data, length, &pos, &record->timestamp) != RC_SUCCESS)
+        {
+            return RC_ERROR_BAD_PARAM;
+        }
+        // First event of the frame absolute, then the distance to the previous one     (N1)
+        record->absolute = (me->has_event == FALSE) ? TRUE : FALSE;
+        me->has_event    = TRUE;
+    }
+    else if (tag == (uint8_t)TAWIRE_TAG_NAME)
+    {
+        uint8_t len;
+
+        if ((pos + 2U) > length)
+        {
+            return RC_ERROR_BAD_PARAM;
+        }
+        record->tag = TAWIRE_TAG_NAME;
+        record->id  = data[pos++];
+        len         = data[pos++];
+        if ((len > TAWIRE_NAME_MAX) || ((pos + len) > length))
+        {
+            return RC_ERROR_BAD_PARAM;
+        }
+        memcpy(record->name, &data[pos], len);
+        record->name[len] = '\0';
+        pos += len;
+    }
+    else if (tag == (uint8_t)TAWIRE_TAG_STATS)
+    {
+        uint32_t *const fields[] = { &record->stats.elapsed, &record->stats.count, &record->stats.min,
+                                     &record->stats.max, &record->stats.mean, &record->stats.stddev };
+
+        if ((pos + 2U) > length)
+        {
+            return RC_ERROR_BAD_PARAM;
+        }
+        record->tag         = TAWIRE_TAG_STATS;
+        record->stats.id    = data[pos++];
+        record->stats.mode  = (uint8_t)(data[pos] >> TAWIRE_MODE_SHIFT);
+        record->stats.state = (uint8_t)(data[pos] & TAWIRE_STATE_MASK);
+        pos++;
+        for (uint8_t i = 0U; i < (sizeof(fields) / sizeof(fields[0])); i++)
+        {
+            if (TAWIRE_getVarint(data, length, &pos, fields[i]) != RC_SUCCESS)
+            {
+                return RC_ERROR_BAD_PARAM;
+            }
+        }
+        record->stats.max  += record->stats.min;
+        record->stats.mean += record->stats.min;
+    }
+    else if (tag == (uint8_t)TAWIRE_TAG_DROPPED)
+    {
+        record->tag = TAWIRE_TAG_DROPPED;
+        if (TAWIRE_getVarint(data, length, &pos, &record->dropped) != RC_SUCCESS)
+        {
+            return RC_ERROR_BAD_PARAM;
+        }
+    }
+    else
+    {
+        return RC_ERROR_BAD_PARAM;      // Unknown tag, the length of the record is unknown
+    }
+
+    me->pos = pos;
+    return RC_SUCCESS;
+}
+
+/**
+ * Func to read one varint.
+ * \param uint8_t const *const data : [IN] record bytes
+ * \param uint16_t const length     : [IN] number of record bytes
+ * \param uint16_t *const pos       : [IN/OUT] read position, moved behind the varint
+ * \param uint32_t *const value     : [OUT] decoded value
+ * \return RC_SUCCESS when success and RC_ERROR_BAD_PARAM when the data ends inside the varint
+*/
+RC_t TAWIRE_getVarint(uint8_t const *const data, uint16_t const length, uint16_t *const pos, uint32_t *const value)
+{
+    uint32_t result = 0UL;
+    uint8_t shift = 0U;
+
+    for (uint8_t i = 0U; i < TAWIRE_VARINT_MAX; i++)
+    {
+        uint8_t byte;
+
+        if (*pos >= length)
+        {
+            return RC_ERROR_BAD_PARAM;
+        }
+        byte    = data[(*pos)++];
+        result |= (uint32_t)(byte & TAWIRE_VARINT_BITS) << shift;
+        shift  += 7U;
+        if ((byte & TAWIRE_VARINT_MORE) == 0U)
+        {
+            *value = result;
+            return RC_SUCCESS;
+        }
+    }
+    return RC_ERROR_BAD_PARAM;
+}
+
+/**
+ * Func to calculate the CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) of a block.
+ * \param uint8_t const *const data : [IN] data
+ * \param uint16_t const length     : [IN] number of bytes
+ * \return CRC
+*/
+uint16_t TAWIRE_crc16(uint8_t const *const data, uint16_t const length)
+{
+    uint16_t crc = TAWIRE_CRC_INIT;
+
+    for (uint16_t i = 0U; i < length; i++)
+    {
+        crc = (uint16_t)(crc << 8U) ^ ta_g_crc_table[(uint8_t)(crc >> 8U) ^ data[i]];
+    }
+    return crc;
+}
+
+/**
+ * Func to write a value as unsigned LEB128 varint (7 bit per byte, low bits first).
+ * \param uint8_t *const out        : [OUT] destination, TAWIRE_VARINT_MAX bytes of room
+ * \param uint16_t pos              : [IN] write position
+ * \param uint32_t value            : [IN] value
+ * \return position behind the varint
+*/
+static uint16_t TAWIRE__putVarint(uint8_t *const out, uint16_t pos, uint32_t value)
+{
+    while (value > TAWIRE_VARINT_BITS)
+    {
+        out[pos++] = (uint8_t)((value & TAWIRE_VARINT_BITS) | TAWIRE_VARINT_MORE);
+        value    >>= 7U;
+    }
+    out[pos++] = (uint8_t)value;
+    return pos;
+}
+
+/**
+ * Func to copy a complete record into the frame, keeping room for the CRC.
+ * \param TA_WireFrame_t *const me      : [IN/OUT] frame
+ * \param uint8_t const *const record   : [IN] record
+ * \param uint16_t const length         : [IN] record length
+ * \return RC_SUCCESS when success and RC_ERROR_BUFFER_FULL when the record does not fit
+*/
+static RC_t TAWIRE__append(TA_WireFrame_t *const me, uint8_t const *const record, uint16_t const length)
+{
+    if ((uint32_t)me->length + length + TAWIRE_CRC_SIZE > me->size)
+    {
+        return RC_ERROR_BUFFER_FULL;
+    }
+
+    memcpy(&me->buffer[me->length], record, length);
+    me->length = me->length + length;
+
+    return RC_SUCCESS;
+}
+
+/* NOTE
+ *
+ * 1. Delta timestamps - events of a busy system are a few hundred to a few thousand cycles apart,
+ * so the delta needs 2 varint bytes instead of 4 for the absolute value. The DWT counter wraps
+ * every ~179 s at 24 MHz; the unsigned subtraction handles this, the decoder adds the deltas up.
+ *
+ * 2. COBS (Consistent Overhead Byte Stuffing) - removes all 0x00 bytes from the frame at a cost
+ * of 1 byte per 254, so 0x00 can delimit frames. A receiver that starts in the middle of a
+ * stream or loses bytes just waits for the next 0x00; the CRC rejects the broken frame.
+ *
+ * 3. STATS size - max and mean are sent as distance to min, which is short because the runs of one
+ * analyzer take similar times, and mode/state share a byte. A typical record (48 M cycles elapsed,
+ * 1000 runs of ~1300 cycles) is 15 byte against 112 byte for the first text line of TA_printStatus,
+ * about 7x less, and takes about a quarter of the CPU time of the snprintf. The 10x goal applies to
+ * the events only (5 byte against 62, ~12x): statistics are sent once per TA_sendAll, the events
+ * carry the high rate. The remaining fields can not be dropped or sent as delta without losing
+ * data: elapsed is not count * mean, it keeps counting over TA_resetStats and holds the open
+ * interval of a running analyzer, and a delta to the previous record of the id would make a frame
+ * depend on the one before, which a receiver starting in the middle of the stream never saw (N2).
+ */
+
+/* [TAWire.c] END OF FILE */
@@ -0,0 +1,219 @@
+/**
+* \file <TAWire.h>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Binary wire format of the Timing Analyzer (encoder and decoder)
+*
+* Compact replacement for the snprintf text output: records are collected in a frame, timestamps
+* are delta encoded as varints, analyzers are referred to by their id (names are announced once
+* with a NAME record). A finished frame is protected by a CRC16 and COBS encoded, so a 0x00 byte
+* marks the end of every frame and a receiver can resynchronize after lost bytes.
+*
+*   frame on the wire : COBS( record record ... CRC16 ) 0x00
+*   record            : tag byte + fields, all numbers as unsigned LEB128 varints
+*
+* The module does no I/O and is shared with the host decoder (host/tools/ta_decode.c).
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+**/
+
+#ifndef TAWIRE_H
+#define TAWIRE_H
+
+#include "global.h"
+#include "TimingAnalyzer_config.h"
+#include "TATrace.h"
+
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### Defines/Macros
+#define TAWIRE_DELIMITER        (0x00U)                                     // Ends every frame on the wire
+#define TAWIRE_CRC_SIZE         (2U)
+#define TAWIRE_VARINT_MAX       (5U)                                        // Bytes of a 32 bit varint
+#define TAWIRE_ENCODED_SIZE(n)  ((n) + ((n) / 254U) + 2U)                   // Worst case COBS output incl. delimiter for n input bytes
+#define TAWIRE_NAME_MAX         (32U)                                       // Longer names are cut
+
+//####################### Enumerations
+/**
+* \Record tag enum
+*
+* First byte of every record, the fields follow in the listed order.
+*/
+typedef enum {
+    TAWIRE_TAG_NAME    = 0x01,  /**< \id, length, name bytes (no terminator) */
+    TAWIRE_TAG_STATS   = 0x02,  /**< \id, mode << 4 | state, elapsed, count, min, max - min, mean - min, stddev */
+    TAWIRE_TAG_DROPPED = 0x03,  /**< \number of trace events lost so far */
+    TAWIRE_TAG_EVENT   = 0x10   /**< \0x10 + TA_TraceType_t: id, ctx, timestamp delta */
+} TA_WireTag_t;
+
+//####################### Structures
+/**
+* \Frame under construction
+*
+* The first event of a frame carries its absolute timestamp, every further one the delta to the
+* previous event, so one lost frame does not corrupt the following ones.
+*/
+typedef struct {
+    uint8_t *buffer;            // Payload (records), the CRC is appended by TAWIRE_finish
+    uint16_t size;              // Capacity of buffer
+    uint16_t length;            // Bytes used
+    uint32_t last_timestamp;    // Timestamp of the previous event in this frame
+    boolean_t has_timestamp;    // FALSE until the first event
+} TA_WireFrame_t;
+
+/**
+* \Statistics record
+*/
+typedef struct {
+    uint8_t id;
+    uint8_t mode;
+    uint8_t state;
+    uint32_t elapsed;
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint32_t mean;
+    uint32_t stddev;
+} TA_WireStats_t;
+
+/**
+* \Reader over the records of a decoded frame
+*/
+typedef struct {
+    uint8_t const *data;        // Records, as returned by TAWIRE_decode
+    uint16_t length;
+    uint16_t pos;               // Next record
+    boolean_t has_event;        // FALSE until the first event, which carries the absolute timestamp
+} TA_WireReader_t;
+
+/**
+* \One record read by TAWIRE_readNext, only the fields of its tag are set
+*/
+typedef struct {
+    TA_WireTag_t tag;           // TAWIRE_TAG_EVENT for all event types
+    uint8_t type;               // EVENT: TA_TraceType_t
+    uint8_t id;                 // EVENT, NAME
+    uint8_t ctx;                // EVENT: exception number
+    boolean_t absolute;         // EVENT: timestamp is the absolute 32 bit counter, otherwise the delta to the previous event
+    uint32_t timestamp;         // EVENT
+    char name[TAWIRE_NAME_MAX + 1U];    // NAME, zero terminated
+    TA_WireStats_t stats;       // STATS
+    uint32_t dropped;           // DROPPED
+} TA_WireRecord_t;
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * Func to start a new empty frame.
+ * \param TA_WireFrame_t *const me  : [OUT] frame
+ * \param uint8_t *const buffer     : [IN] payload memory, at least TAWIRE_CRC_SIZE larger than the records
+ * \param uint16_t const size       : [IN] size of buffer
+ * \return RC_SUCCESS when success, RC_ERROR_NULL when a pointer param is null
+*/
+RC_t TAWIRE_begin(TA_WireFrame_t *const me, uint8_t *const buffer, uint16_t const size);
+
+/**
+ * Func to append a trace event record.
+ * \param TA_WireFrame_t *const me              : [IN/OUT] frame
+ * \param TA_TraceEvent_t const *const event    : [IN] event
+ * \return RC_SUCCESS when success and RC_ERROR_BUFFER_FULL when the frame has no room (frame unchanged)
+*/
+RC_t TAWIRE_putEvent(TA_WireFrame_t *const me, TA_TraceEvent_t const *const event);
+
+/**
+ * Func to append a name announcement record.
+ * \param TA_WireFrame_t *const me  : [IN/OUT] frame
+ * \param uint8_t const id          : [IN] analyzer id
+ * \param const char *const name    : [IN] analyzer name, cut to TAWIRE_NAME_MAX
+ * \return RC_SUCCESS when success and RC_ERROR_BUFFER_FULL when the frame has no room (frame unchanged)
+*/
+RC_t TAWIRE_putName(TA_WireFrame_t *const me, uint8_t const id, const char *const name);
+
+/**
+ * Func to append a statistics record.
+ * \param TA_WireFrame_t *const me              : [IN/OUT] frame
+ * \param TA_WireStats_t const *const stats     : [IN] statistics
+ * \return RC_SUCCESS when success and RC_ERROR_BUFFER_FULL when the frame has no room (frame unchanged)
+*/
+RC_t TAWIRE_putStats(TA_WireFrame_t *const me, TA_WireStats_t const *const stats);
+
+/**
+ * Func to append a dropped events record.
+ * \param TA_WireFrame_t *const me  : [IN/OUT] frame
+ * \param uint32_t const dropped    : [IN] number of lost trace events
+ * \return RC_SUCCESS when success and RC_ERROR_BUFFER_FULL when the frame has no room (frame unchanged)
+*/
+RC_t TAWIRE_putDropped(TA_WireFrame_t *const me, uint32_t const dropped);
+
+/**
+ * Func to close a frame: appends the CRC and writes the COBS encoded frame including the delimiter.
+ * \param TA_WireFrame_t *const me  : [IN/OUT] frame, empty afterwards
+ * \param uint8_t *const out        : [OUT] encoded frame
+ * \param uint16_t const size       : [IN] size of out, TAWIRE_ENCODED_SIZE(payload + TAWIRE_CRC_SIZE) is always enough
+ * \return number of bytes written to out, 0 for an empty frame or when out is too small
+*/
+uint16_t TAWIRE_finish(TA_WireFrame_t *const me, uint8_t *const out, uint16_t const size);
+
+/**
+ * Func to decode one received frame (without delimiter) in place: COBS decoding and CRC check.
+ * \param uint8_t *const frame      : [IN/OUT] received bytes, records afterwards
+ * \param uint16_t const length     : [IN] number of received bytes
+ * \param uint16_t *const records   : [OUT] length of the records without CRC
+ * \return RC_SUCCESS when success, RC_ERROR_NULL when a pointer param is null and
+ *         RC_ERROR_BAD_PARAM when the frame is corrupted (COBS or CRC error)
+*/
+RC_t TAWIRE_decode(uint8_t *const frame, uint16_t const length, uint16_t *const records);
+
+/**
+ * Func to start reading the records of a frame checked by TAWIRE_decode.
+ * \param TA_WireReader_t *const me         : [OUT] reader
+ * \param uint8_t const *const records      : [IN] records
+ * \param uint16_t const length             : [IN] length of the records
+ * \return RC_SUCCESS when success, RC_ERROR_NULL when a pointer param is null
+*/
+RC_t TAWIRE_readBegin(TA_WireReader_t *const me, uint8_t const *const records, uint16_t const length);
+
+/**
+ * Func to read the next record. The host tools use it, so all of them follow the record layout of this file.
+ * \param TA_WireReader_t *const me         : [IN/OUT] reader
+ * \param TA_WireRecord_t *const record     : [OUT] record
+ * \return RC_SUCCESS when a record was read, RC_ERROR_BUFFER_EMTPY behind the last one and
+ *         RC_ERROR_BAD_PARAM for a truncated record or an unknown tag (the rest of the frame can not be read)
+*/
+RC_t TAWIRE_readNext(TA_WireReader_t *const me, TA_WireRecord_t *const record);
+
+/**
+ * Func to read one varint.
+ * \param uint8_t const *const data : [IN] record bytes
+ * \param uint16_t const length     : [IN] number of record bytes
+ * \param uint16_t *const pos       : [IN/OUT] read position, moved behind the varint
+ * \param uint32_t *const value     : [OUT] decoded value
+ * \return RC_SUCCESS when success and RC_ERROR_BAD_PARAM when the data ends inside the varint
+*/
+RC_t TAWIRE_getVarint(uint8_t const *const data, uint16_t const length, uint16_t *const pos, uint32_t *const value);
+
+/**
+ * Func to calculate the CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) of a block.
+ * \param uint8_t const *const data : [IN] data
+ * \param uint16_t const length     : [IN] number of bytes
+ * \return CRC
+*/
+uint16_t TAWIRE_crc16(uint8_t const *const data, uint16_t const length);
+
+#endif /* TAWIRE_H */
+
+/* [TAWire.h] END OF FILE */
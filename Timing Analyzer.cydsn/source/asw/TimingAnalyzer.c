@@ -24,6 +24,8 @@
 #include <string.h>
 #include "project.h"
 #include "TimingAnalyzer.h"
+#include "TimingAnalyzer_fast.h"
+#include "TATrace.h"
 #include "Pins.h"
 #include "UART_LOG.h"
 
@@ -33,19 +35,26 @@
 // MISRA Rule 12.1/12.2 : Avoid magic numbers. Use symbolic constants. (We replaced all numeric literals with symbolic constants.)
 // MISRA Rule 8.12 (2004) : Use #define or const for magic numbers. (Fully compliant (uses macros))
 // MISRA Rule 10.3 : Implicit conversions should be avoided. (All constants use explicit suffix UL (unsigned long).)    // ???
-#define TA_MAX_ANALYZERS           (10UL)
 #define TA_MAX_PINS                (3UL)
 #define TA_MAX_MODES               (5UL)
 #define TA_SYSTICK_RELOAD_VALUE    ((BCLK__BUS_CLK__HZ / 1000UL) - 1UL)
 #define TA_SYSTICK_RESET_VALUE     (0UL)
 #define TA_DWT_RESET_VALUE         (0UL)
 #define TA_MAX_32BIT_VALUE         (4294967295UL)   /* 0xFFFFFFFFUL */
-#define TA_COUNTER_INCREMENT       (1UL)
 #define TA_SCALE_FACTOR            (1000000UL) /* 10^6 for 6 decimal places */
+#define TA_STATS_EXACT_LIMIT       (0x80000000ULL)  /* Deviations below 2^31 (fixed point) can be squared exactly in 64 bit */
+#define TA_STATS_ROUND             (1LL << (TA_CFG_STATS_FRAC_BITS - 1U))
+#define TA_ID_BUS                  (*(reg8 *)(TA_CFG_ID_BUS_REG))   /* One store sets all 8 bus lines    (N24) */
+#define TA_ID_BUS_IDLE             (0U)
 
 /*****************************************************************************/
 /* Global variable definitions (declared in header file with 'extern')       */
 /*****************************************************************************/
+volatile uint32_t ta_g_system_ms = 0UL;         // Global millisecond counter
+volatile boolean_t ta_g_systick_reload = FALSE; // Reload seen by TA_readSysTick, not yet counted by SysTick_Handler  (N19)
+uint32_t ta_g_fast_overhead = 0UL;              // Calibrated cost of TA_START_DWT/TA_STOP_DWT
+uint32_t ta_g_cycles_state = 0UL;               // Wrap epoch and last MSB of DWT->CYCCNT     (N18)
+volatile uint32_t ta_g_enable_mask = TA_CFG_ENABLE_MASK;   // Enabled instrumentation categories (N22)
 
 /*****************************************************************************/
 /* Local type definitions ('typedef')                                        */
@@ -54,20 +63,51 @@
 /*****************************************************************************/
 /* Local variable definitions ('static')                                     */
 /*****************************************************************************/
-static TA_t* ta_g_analyzers[TA_MAX_ANALYZERS];    //  (N5)
+static TA_t* ta_g_analyzers[TA_MAX_ANALYZERS];    // Indexed by id, NULL_PTR for a free id   (N5)
 static uint8_t ta_g_analyzer_count = 0U;
-volatile static uint32_t ta_g_system_ms = 0UL; // Global millisecond counter
+static uint8_t ta_g_free_next[TA_MAX_ANALYZERS];    // Free list of released ids, linked by id   (N21)
+static uint8_t ta_g_free_head = TA_ID_NONE;         // Last released id, TA_ID_NONE when the list is empty
+static uint8_t ta_g_ids_issued = 0U;                // Ids below were handed out at least once
+#if (TA_CFG_ANALYZER_POOL == ON)
+static TA_t ta_g_pool[TA_MAX_ANALYZERS];            // Analyzers of TA_createHandle, pool entry n has id n
+#endif
+static uint32_t ta_g_overhead[TA_MAX_MODES];    // Calibrated cost of an empty start/stop pair per mode (N11)
+static uint8_t ta_g_systick_users = 0U;          // SysTick analyzers (+1 without TA_CFG_TICKLESS), SysTick runs while > 0 (N20)
+#if (TA_CFG_PREEMPTION == ON)
+static TA_t* ta_g_running[TA_CFG_PREEMPTION_DEPTH];    // Running DWT analyzers, innermost on top (N15)
+static uint8_t ta_g_running_depth = 0U;
+#endif
 
 /*****************************************************************************/
 /* Local function prototypes ('static')                                      */
 /*****************************************************************************/
+static void TA__calibrationPin(uint8_t state);
+static boolean_t TA__countsCycles(TA_Mode_t const mode);
+static void TA__acquireSysTick(void);
+static void TA__releaseSysTick(void);
+static RC_t TA__checkConfig(TA_Mode_t const mode, TA_PinFunc_t const pin_ctrl, const char* const name);
+static uint8_t TA__allocId(void);
+static void TA__register(TA_t *const me, uint8_t const id, TA_Mode_t const mode, TA_PinFunc_t const pin_ctrl, const char* const name);
+static uint64_t TA__mulDeviation(sint64_t const delta, sint64_t const delta2);
+static uint32_t TA__sqrt(uint64_t value);
+static void TA__updateStats(TA_Stats_t *const stats, uint32_t const value);
+static uint32_t TA__getStatsMean(TA_Stats_t const *const stats);
+static void TA__recordPeriod(TA_t *const me);
+static void TA__openInterval(TA_t *const me);
+static void TA__closeInterval(TA_t *const me);
+#if (TA_CFG_ID_BUS == ON)
+static void TA__showActive(void);
+#endif
+#if (TA_CFG_PRINT_PENDSV == ON)
+static void TA__pendSvHandler(void);
+#endif
 
 /*****************************************************************************/
 /* Function implementation - global ('extern') and local ('static')          */
 /*****************************************************************************/
 
 /**
- * Func to initialize of the necessary peripherals like Set up SysTick timer (1 ms), enable DWT counter, and configure GPIO pins.
+ * Func to initialize of the necessary peripherals like Set up SysTick timer (1 ms, with TA_CFG_TICKLESS not before the first SysTick analyzer), enable DWT counter, and configure GPIO pins.
  * \param None
  * \return RC_SUCCESS when success and RC_ERROR_INVALID_STATE when Hardware not properly initilized
 */
@@ -75,25 +115,199 @@ RC_t TA_init(void)
 {
     RC_t res = RC_SUCCESS;
     
-    // Initialize SysTick timer (1 ms) // Will cause issues with OS's cnt_systick - Use respective OS's handler if needed
-    CySysTickInit();									// Activate Systick counter     // (N7)
-	CySysTickSetCallback(0, SysTick_Handler);           // Set ISR for Systick
-	CySysTickSetReload(BCLK__BUS_CLK__HZ / 1000 - 1);   // Set 1ms cycle Time
-	CySysTickEnable();									// Enable the Callback of the systick
-
     ta_g_system_ms = 0;      // Reset the global time counter
+    ta_g_systick_reload = FALSE;
+    ta_g_systick_users = 0U;
+    
+    #if (TA_CFG_TICKLESS == OFF)
+    // SysTick timer (1 ms) for the whole runtime, otherwise only while a SysTick analyzer exists (N20)
+    TA__acquireSysTick();
+    #endif
+    
+    #if (TA_CFG_PREEMPTION == ON)
+    ta_g_running_depth = 0U;
+    #endif
+    
+    #if (TA_CFG_ID_BUS == ON)
+    TA_ID_BUS = TA_ID_BUS_IDLE;
+    #endif
     
     // Enable DWT Cycle Counter                                                                 // (N2)
     CoreDebug->DEMCR    |= CoreDebug_DEMCR_TRCENA_Msk;     // Activate the trace unit
     DWT->CYCCNT          = TA_DWT_RESET_VALUE;             // Resets the cycle counter          // (N3)
+    ta_g_cycles_state    = 0UL;                            // Epoch 0, MSB 0
     DWT->CTRL           |= DWT_CTRL_CYCCNTENA_Msk;         // Starts the DWT counter running    // (N4)
 
     // Set the pins low initially
     Pins_Init();
     
+    #if (TA_CFG_PRINT_PENDSV == ON)
+    // Deferred printing at the lowest exception priority                                      // (N14)
+    (void)CyIntSetSysVector(CY_INT_PEND_SV_IRQ, TA__pendSvHandler);
+    NVIC_SetPriority(PendSV_IRQn, (1UL << __NVIC_PRIO_BITS) - 1UL);
+    #endif
+    
+    #if (TA_CFG_CALIBRATION == ON)
+    // Measure our own start/stop cost, needs the running DWT counter
+    res = TA_calibrate();
+    #endif
+    
+    return res;
+}
+
+/**
+ * Func to measure the analyzer's own cost of an empty start/stop pair for every mode and for the
+ * inline DWT path of TimingAnalyzer_fast.h. Called by TA_init, the result is subtracted from every measured interval.
+ * \param None
+ * \return RC_SUCCESS when success and RC_ERROR_INVALID_STATE when the DWT counter does not run
+*/
+RC_t TA_calibrate(void)
+{
+    RC_t res = RC_SUCCESS;
+    
+#if (TA_CFG_SYSTICK_SUBMS == ON)
+    static const TA_Mode_t calibratedModes[] = { TA_MODE_DWT, TA_MODE_DWT_PIN, TA_MODE_SYSTICK, TA_MODE_SYSTICK_PIN };
+#else
+    static const TA_Mode_t calibratedModes[] = { TA_MODE_DWT, TA_MODE_DWT_PIN };
+#endif
+    TA_t probe;
+    uint32_t best;
+    
+    // Without a running counter every measurement would be 0
+    uint32_t now = DWT->CYCCNT;
+    if (DWT->CYCCNT == now)
+    {
+        return RC_ERROR_INVALID_STATE;
+    }
+    
+    for (uint8_t i = 0U; i < (sizeof(calibratedModes) / sizeof(calibratedModes[0])); i++)
+    {
+        TA_Mode_t mode = calibratedModes[i];
+        
+        // Probe is not registered and drives no real pin, the pin write lies outside the interval anyway
+        memset(&probe, 0, sizeof(TA_t));
+        probe.name             = "Calibration";
+        probe.id               = TA_ID_NONE;
+        probe.mode             = mode;
+        probe.pin_control_func = TA__calibrationPin;
+        
+        // The SysTick time base has to run while its own modes are measured
+        if ((TA_MODE_SYSTICK == mode) || (TA_MODE_SYSTICK_PIN == mode))
+        {
+            TA__acquireSysTick();
+        }
+        
+        // Measure uncompensated, keep the smallest result (interrupts can only make it larger)
+        ta_g_overhead[mode] = 0UL;
+        best = TA_MAX_32BIT_VALUE;
+        for (uint32_t run = 0UL; run < TA_CFG_CALIBRATION_RUNS; run++)
+        {
+            probe.state            = TA_STATE_IDLE;
+            probe.raw_elapsed_time = 0UL;
+            (void)TA_start(&probe);
+            (void)TA_stop(&probe);
+            if (probe.raw_elapsed_time < best)
+            {
+                best = (uint32_t)probe.raw_elapsed_time;
+            }
+        }
+        ta_g_overhead[mode] = best;
+        
+        if ((TA_MODE_SYSTICK == mode) || (TA_MODE_SYSTICK_PIN == mode))
+        {
+            TA__releaseSysTick();
+        }
+    }
+    
+    // Same for the inline path, which does not go through TA_calculateElapsedTime
+    ta_g_fast_overhead = 0UL;
+    best = TA_MAX_32BIT_VALUE;
+    for (uint32_t run = 0UL; run < TA_CFG_CALIBRATION_RUNS; run++)
+    {
+        probe.raw_elapsed_time = 0UL;
+        TA_beginRun(&probe);                    // TA_START_DWT/TA_STOP_DWT, also with TA_CFG_ENABLE OFF
+        TA_openDwt(&probe);
+        TA_closeDwt(&probe, TA_STATE_STOPPED);
+        if (probe.raw_elapsed_time < best)
+        {
+            best = (uint32_t)probe.raw_elapsed_time;
+        }
+    }
+    ta_g_fast_overhead = best;
+    
     return res;
 }
 
+/**
+ * Func which returns the calibrated self-overhead of a mode, see TA_calibrate.
+ * \param TA_Mode_t const mode          : [IN] measurement mode
+ * \return overhead in counter units (cycles, 0 for SysTick ms and pin only modes)
+*/
+uint32_t TA_getOverhead(TA_Mode_t const mode)
+{
+    return (mode < TA_MAX_MODES) ? ta_g_overhead[mode] : 0UL;
+}
+
+/**
+ * Func dummy pin used while calibrating, so no real pin toggles during TA_init.
+ * \param uint8_t state             : [IN] ignored
+ * \return None
+*/
+static void TA__calibrationPin(uint8_t state)
+{
+    (void)state;
+}
+
+/**
+ * Func which tells whether the counter unit of a mode is the bus clock cycle or the ms.
+ * \param TA_Mode_t const mode          : [IN] measurement mode
+ * \return TRUE for the DWT modes and, with TA_CFG_SYSTICK_SUBMS, the SysTick modes
+*/
+static boolean_t TA__countsCycles(TA_Mode_t const mode)
+{
+    if ((TA_MODE_DWT == mode) || (TA_MODE_DWT_PIN == mode))
+    {
+        return TRUE;
+    }
+#if (TA_CFG_SYSTICK_SUBMS == ON)
+    if ((TA_MODE_SYSTICK == mode) || (TA_MODE_SYSTICK_PIN == mode))
+    {
+        return TRUE;
+    }
+#endif
+    return FALSE;
+}
+
+/**
+ * Func to start the 1 ms SysTick for its first user.
+ * \param None
+ * \return None
+*/
+static void TA__acquireSysTick(void)
+{
+    if (ta_g_systick_users++ == 0U)
+    {
+        // Will cause issues with OS's cnt_systick - Use respective OS's handler if needed
+        CySysTickInit();									// Activate Systick counter     // (N7)
+        CySysTickSetCallback(0, SysTick_Handler);           // Set ISR for Systick
+        CySysTickSetReload(BCLK__BUS_CLK__HZ / 1000 - 1);   // Set 1ms cycle Time
+        CySysTickEnable();									// Enable the Callback of the systick
+    }
+}
+
+/**
+ * Func to stop the SysTick when its last user is gone.
+ * \param None
+ * \return None
+*/
+static void TA__releaseSysTick(void)
+{
+    if ((ta_g_systick_users > 0U) && (--ta_g_systick_users == 0U))
+    {
+        CySysTickStop();
+    }
+}
+
 /**
  * Func to initializes an analyzer struct with configuration and assign function pointers for pin control.
  * \param TA_t *const me                : [IN/OUT] struct of Analyzer related parameters
@@ -101,61 +315,190 @@ RC_t TA_init(void)
  * \param TA_PinFunc_t const pin_ctrl   : [IN] func pointer to control a GPIO pin
  * \param const char const *name        : [IN] name of the Analyzer
  * \return RC_SUCCESS when success, RC_ERROR_NULL when a pointer param is null
- *         RC_ERROR_BAD_PARAM when unexpected params are passed and 
+ *         RC_ERROR_BAD_PARAM when unexpected params are passed, RC_ERROR_BUSY when the analyzer is already created and 
  *         RC_ERROR_BUFFER_FULL when max analyzer count is reached
 */
 RC_t TA_create(TA_t *const me, TA_Mode_t const mode, TA_PinFunc_t const pin_ctrl, const char* const name)
 {
     RC_t res = RC_SUCCESS;
+    uint8_t id;
     
     // Validate the input
-    if (me == NULL_PTR || name == NULL_PTR) // warning Nullprt == me? All comparisions - datatypes and comparion?
+    if (me == NULL_PTR)
     {
-        return RC_ERROR_NULL ;              // Can we compare a conatant value with the desired value?
+        return RC_ERROR_NULL;
     }
     
-    if ((TA_MODE_DWT_PIN == mode || TA_MODE_SYSTICK_PIN == mode || TA_MODE_PIN == mode) && (pin_ctrl == NULL_PTR))
+    res = TA__checkConfig(mode, pin_ctrl, name);
+    if (res != RC_SUCCESS)
+    {
+        return res;
+    }
+    
+    // A second create would leave a stale registry entry behind
+    if ((me->id < TA_MAX_ANALYZERS) && (ta_g_analyzers[me->id] == me))
+    {
+        return RC_ERROR_BUSY;
+    }
+    
+    id = TA__allocId();
+    if (id == TA_ID_NONE)
+    {
+        return RC_ERROR_BUFFER_FULL;
+    }
+    
+    TA__register(me, id, mode, pin_ctrl, name);
+    
+    return res;
+}
+
+#if (TA_CFG_ANALYZER_POOL == ON)
+/**
+ * Func to create an analyzer in the static pool and hand out its handle, which is also its id.
+ * The analyzer is reached with TA_getAnalyzer(handle), no TA_t object is needed in the application.
+ * \param TA_Handle_t *const handle     : [OUT] handle of the new analyzer, TA_ID_NONE on error
+ * \param TA_Mode_t const mode          : [IN] type of the configuration mode we need to run the analyzer
+ * \param TA_PinFunc_t const pin_ctrl   : [IN] func pointer to control a GPIO pin
+ * \param const char const *name        : [IN] name of the Analyzer
+ * \return same as TA_create
+*/
+RC_t TA_createHandle(TA_Handle_t *const handle, TA_Mode_t const mode, TA_PinFunc_t const pin_ctrl, const char* const name)
+{
+    RC_t res = RC_SUCCESS;
+    uint8_t id;
+    
+    if (handle == NULL_PTR)
     {
         return RC_ERROR_NULL;
     }
+    *handle = TA_ID_NONE;
+    
+    res = TA__checkConfig(mode, pin_ctrl, name);
+    if (res != RC_SUCCESS)
+    {
+        return res;
+    }
     
-    if (strlen(name) == 0UL || mode > TA_MAX_MODES)
+    id = TA__allocId();
+    if (id == TA_ID_NONE)
+    {
+        return RC_ERROR_BUFFER_FULL;
+    }
+    
+    // The id selects the pool entry, so pool and registry need no search
+    TA__register(&ta_g_pool[id], id, mode, pin_ctrl, name);
+    *handle = id;
+    
+    return res;
+}
+
+/**
+ * Func to delete an analyzer created by TA_createHandle, the handle becomes free for the next create.
+ * \param TA_Handle_t const handle      : [IN] handle
+ * \return RC_SUCCESS when success and RC_ERROR_BAD_PARAM when the handle is no pool analyzer
+*/
+RC_t TA_deleteHandle(TA_Handle_t const handle)
+{
+    // A handle may only delete its own pool entry, not an application analyzer with the same id
+    if ((handle >= TA_MAX_ANALYZERS) || (ta_g_analyzers[handle] != &ta_g_pool[handle]))
     {
         return RC_ERROR_BAD_PARAM;
     }
     
-    if ((TA_MODE_DWT == mode || TA_MODE_SYSTICK == mode) && (pin_ctrl == NULL_PTR)) 
+    return TA_delete(&ta_g_pool[handle]);
+}
+#endif
+
+/**
+ * Func to check the creation parameters of an analyzer.
+ * \param TA_Mode_t const mode          : [IN] type of the configuration mode we need to run the analyzer
+ * \param TA_PinFunc_t const pin_ctrl   : [IN] func pointer to control a GPIO pin
+ * \param const char const *name        : [IN] name of the Analyzer
+ * \return RC_SUCCESS when valid, RC_ERROR_NULL when a pointer param is null and
+ *         RC_ERROR_BAD_PARAM when unexpected params are passed
+*/
+static RC_t TA__checkConfig(TA_Mode_t const mode, TA_PinFunc_t const pin_ctrl, const char* const name)
+{
+    if (name == NULL_PTR)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    if ((TA_MODE_DWT_PIN == mode || TA_MODE_SYSTICK_PIN == mode || TA_MODE_PIN == mode) && (pin_ctrl == NULL_PTR))
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    if (strlen(name) == 0UL || mode >= TA_MAX_MODES)
     {
         return RC_ERROR_BAD_PARAM;
     }
     
-    if(ta_g_analyzer_count >= TA_MAX_ANALYZERS)
+    if ((TA_MODE_DWT == mode || TA_MODE_SYSTICK == mode) && (pin_ctrl != NULL_PTR)) 
     {
-        res = RC_ERROR_BUFFER_FULL;
+        return RC_ERROR_BAD_PARAM;
     }
     
-    // Add to global analyzer list
+    return RC_SUCCESS;
+}
+
+/**
+ * Func to take an id from the free list, or a never used one when the list is empty. O(1).
+ * \param None
+ * \return id, TA_ID_NONE when all TA_MAX_ANALYZERS ids are in use
+*/
+static uint8_t TA__allocId(void)
+{
+    uint8_t id = ta_g_free_head;
+    
+    if (id != TA_ID_NONE)
+    {
+        ta_g_free_head = ta_g_free_next[id];
+    }
+    else if (ta_g_ids_issued < TA_MAX_ANALYZERS)
+    {
+        id = ta_g_ids_issued++;
+    }
     else
     {
-        ta_g_analyzers[ta_g_analyzer_count++] = me;
+        // All ids in use
+    }
     
-        // Clear the entire struct first
-        memset(me, 0, sizeof(TA_t));
+    return id;
+}
+
+/**
+ * Func to initialize an analyzer and enter it into the registry under its id.
+ * \param TA_t *const me                : [OUT] struct of Analyzer related parameters
+ * \param uint8_t const id              : [IN] free id, see TA__allocId
+ * \param TA_Mode_t const mode          : [IN] checked measurement mode
+ * \param TA_PinFunc_t const pin_ctrl   : [IN] checked pin function
+ * \param const char const *name        : [IN] name of the Analyzer
+ * \return None
+*/
+static void TA__register(TA_t *const me, uint8_t const id, TA_Mode_t const mode, TA_PinFunc_t const pin_ctrl, const char* const name)
+{
+    // Clear the entire struct first
+    memset(me, 0, sizeof(TA_t));
     
-        // Storing the info
-        me->mode    = mode;
-        me->state   = TA_STATE_IDLE;
-        me->name    = name;
+    // Storing the info
+    me->mode    = mode;
+    me->state   = TA_STATE_IDLE;
+    me->name    = name;
+    me->id      = id;
     
-        // Initialize the timing fields
-        me->start_time      = 0UL;
-        me->stop_time       = 0UL;
-        me->elapsed_time    = 0UL;
-        
-        // Assign pin control function pointers
-        me->pin_control_func = pin_ctrl;
+    // Assign pin control function pointers
+    me->pin_control_func = pin_ctrl;
+    
+    ta_g_analyzers[id] = me;
+    ta_g_analyzer_count++;
+    TATRACE_RECORD(id, TATRACE_EVT_CREATE);     // Marks the id reuse in the trace (N4 of TATrace.c)
+    
+    // The ms counter only runs while somebody needs it (N20)
+    if ((TA_MODE_SYSTICK == mode) || (TA_MODE_SYSTICK_PIN == mode))
+    {
+        TA__acquireSysTick();
     }
-    return res;
 }
 
 /**
@@ -181,24 +524,37 @@ RC_t TA_start(TA_t *const me)
         return RC_ERROR_BUSY;
     }
     
+    // Start-to-start interval, before the measured interval opens
+    if (me->period.nominal != 0UL)
+    {
+        TA__recordPeriod(me);
+    }
+    
+    // Event before the interval opens, so it is not measured
+    TATRACE_RECORD(me->id, TATRACE_EVT_START);
+    
     // Handle pin output first for precision
     if ((TA_MODE_SYSTICK_PIN == me->mode) || (TA_MODE_DWT_PIN  == me->mode) || (TA_MODE_PIN  == me->mode))
     {
         if (me->pin_control_func != NULL_PTR)
         {
             me->pin_control_func(1U);   /* Turn ON pin */
+            TATRACE_RECORD_EDGE(me->id, TATRACE_EVT_PIN_HIGH);   // Timestamp of the edge (N25)
         } else {
             return RC_ERROR_NULL;
         }
     }
     
+    // A start always begins a new run
+    me->run_time = 0UL;
+    
     // Fetching the counter FIRST for precision
     if (TA_MODE_SYSTICK == me->mode || TA_MODE_SYSTICK_PIN  == me->mode) {
-        // SysTick counts in ms
-        me->start_time = ta_g_system_ms;  // Start a cycle interval
+        // SysTick time base, ms or bus cycles (N19)
+        me->start_time = TA_readSysTick();  // Start a cycle interval
     } else if (TA_MODE_DWT  == me->mode || TA_MODE_DWT_PIN  == me->mode) {
         // DWT->CYCCNT = current CPU cycle count
-        me->start_time = DWT->CYCCNT;  // Start a cycle interval
+        TA__openInterval(me);  // Start a cycle interval
     } else {
         // TA_MODE_PIN only - do nothing
     }
@@ -233,12 +589,12 @@ RC_t TA_pause(TA_t *const me)
     
     // Fetching the counter FIRST for precision
     if (TA_MODE_SYSTICK == me->mode || TA_MODE_SYSTICK_PIN == me->mode) {
-        // SysTick counts in ms
-        me->stop_time = ta_g_system_ms;  // Stop current cycle interval
+        // SysTick time base, ms or bus cycles (N19)
+        me->stop_time = TA_readSysTick();  // Stop current cycle interval
         
     } else if (TA_MODE_DWT == me->mode || TA_MODE_DWT_PIN == me->mode) {
         // DWT cycle counter
-        me->stop_time = DWT->CYCCNT;  // Stop current cycle interval
+        TA__closeInterval(me);  // Stop current cycle interval
         
     } else {
         // TA_MODE_PIN only - do nothing
@@ -252,11 +608,14 @@ RC_t TA_pause(TA_t *const me)
         if (me->pin_control_func != NULL_PTR)
         {
             me->pin_control_func(0U); /* Turn OFF pin */
+            TATRACE_RECORD_EDGE(me->id, TATRACE_EVT_PIN_LOW);   // Timestamp of the edge (N25)
         } else {
             return RC_ERROR_NULL;
         }
     }
     
+    TATRACE_RECORD(me->id, TATRACE_EVT_PAUSE);
+    
     // Update state
     me->state = TA_STATE_PAUSED;
     
@@ -285,12 +644,15 @@ RC_t TA_resume(TA_t *const me)
         return RC_ERROR_INVALID_STATE;
     }
     
+    TATRACE_RECORD(me->id, TATRACE_EVT_RESUME);
+    
     // Pin HIGH to indicate resumed timing
     if ((TA_MODE_SYSTICK_PIN == me->mode) || (TA_MODE_DWT_PIN == me->mode) || (TA_MODE_PIN == me->mode))
     {
         if (me->pin_control_func != NULL_PTR)
         {
            me->pin_control_func(1U);   /* Turn ON pin */
+           TATRACE_RECORD_EDGE(me->id, TATRACE_EVT_PIN_HIGH);   // Timestamp of the edge (N25)
         } else {
             return RC_ERROR_NULL;
         }
@@ -298,11 +660,11 @@ RC_t TA_resume(TA_t *const me)
     
     // Fetching the counter FIRST for precision
     if (TA_MODE_SYSTICK == me->mode || TA_MODE_SYSTICK_PIN == me->mode) {
-       // SysTick counts in ms
-        me->start_time = ta_g_system_ms;  // Start new cycle interval
+       // SysTick time base, ms or bus cycles (N19)
+        me->start_time = TA_readSysTick();  // Start new cycle interval
     } else if (TA_MODE_DWT == me->mode || TA_MODE_DWT_PIN == me->mode) {
         // DWT cycle counter
-        me->start_time = DWT->CYCCNT;  // Start new cycle interval
+        TA__openInterval(me);  // Start new cycle interval
     } else {      
         // TA_MODE_PIN only - do nothing
     }
@@ -335,18 +697,41 @@ RC_t TA_stop(TA_t *const me)
         return RC_ERROR_INVALID_STATE;
     }
     
-    // Fetching the counter FIRST for precision
-    if (TA_MODE_SYSTICK == me->mode || TA_MODE_SYSTICK_PIN == me->mode) {
-        // SysTick counts in ms
-        me->stop_time = ta_g_system_ms;  // Stop the cycle interval        
-    } else if (TA_MODE_DWT == me->mode || TA_MODE_DWT_PIN == me->mode) {
-        // DWT cycle counter
-        me->stop_time = DWT->CYCCNT;  // Stop the cycle interval
-    } else {
+    // A paused analyzer has no open interval, its run is already complete
+    if (TA_STATE_RUNNING == me->state)
+    {
+        // Fetching the counter FIRST for precision
+        if (TA_MODE_SYSTICK == me->mode || TA_MODE_SYSTICK_PIN == me->mode) {
+            // SysTick time base, ms or bus cycles (N19)
+            me->stop_time = TA_readSysTick();  // Stop the cycle interval        
+        } else if (TA_MODE_DWT == me->mode || TA_MODE_DWT_PIN == me->mode) {
+            // DWT cycle counter
+            TA__closeInterval(me);  // Stop the cycle interval
+        } else {
+            // TA_MODE_PIN only - do nothing
+        }
+        
+        res = TA_calculateElapsedTime(me);
+    }
+    else if (TA_MODE_SYSTICK == me->mode || TA_MODE_SYSTICK_PIN == me->mode)
+    {
+        // Nothing to add, but the run ends now and not at the pause (budget.last_time)
+        me->stop_time = TA_readSysTick();
+    }
+    else if (TA_MODE_DWT == me->mode || TA_MODE_DWT_PIN == me->mode)
+    {
+        me->stop_time = TA_readCycles64();
+    }
+    else
+    {
         // TA_MODE_PIN only - do nothing
     }
     
-    res = TA_calculateElapsedTime(me);
+    // Run complete - update the statistics
+    if (TA_MODE_PIN != me->mode)
+    {
+        TA_recordRun(me, me->run_time);
+    }
     
     // Clear pin after stopping
     if ((TA_MODE_SYSTICK_PIN == me->mode) || (TA_MODE_DWT_PIN == me->mode) || (TA_MODE_PIN == me->mode))
@@ -354,11 +739,14 @@ RC_t TA_stop(TA_t *const me)
         if (me->pin_control_func != NULL_PTR)
         {
             me->pin_control_func(0U); /* Turn OFF pin */
+            TATRACE_RECORD_EDGE(me->id, TATRACE_EVT_PIN_LOW);   // Timestamp of the edge (N25)
         } else {
             return RC_ERROR_NULL;
         }
     }
     
+    TATRACE_RECORD(me->id, TATRACE_EVT_STOP);
+    
     // Update state
     me->state = TA_STATE_STOPPED;
     
@@ -375,38 +763,50 @@ RC_t TA_stop(TA_t *const me)
 RC_t TA_delete(TA_t *const me)
 {
     RC_t res = RC_SUCCESS;
-    
-    uint8_t index = 0U;
-    boolean_t found = FALSE;
 
     if (me == NULL_PTR)
     {
         return RC_ERROR_NULL;
     }
 
-    // Search for analyzer in global list
-    for (index = 0U; index < ta_g_analyzer_count; index++)
+    // The id is the index into the registry, no search
+    if ((me->id >= TA_MAX_ANALYZERS) || (ta_g_analyzers[me->id] != me))
     {
-        if (ta_g_analyzers[index] == me)
-        {
-            found = TRUE;
-            break;
-        }
+        return RC_ERROR_BAD_PARAM;   // Analyzer not found
     }
 
-    if (found == FALSE)
+    ta_g_analyzers[me->id] = NULL_PTR;
+    ta_g_analyzer_count--;
+    
+    // Release the id, it is handed out next
+    ta_g_free_next[me->id] = ta_g_free_head;
+    ta_g_free_head = me->id;
+    
+    if ((TA_MODE_SYSTICK == me->mode) || (TA_MODE_SYSTICK_PIN == me->mode))
     {
-        return RC_ERROR_BAD_PARAM;   // Analyzer not found
+        TA__releaseSysTick();
     }
-
-    // Shift remaining analyzers left to keep array compact
-    for (uint8_t i = index; i < (ta_g_analyzer_count - 1U); i++)
+    
+    #if (TA_CFG_PREEMPTION == ON)
+    // Deleted while running - must not stay on the running stack
     {
-        ta_g_analyzers[i] = ta_g_analyzers[i + 1U];
+        uint8 intr = CyEnterCriticalSection();
+        uint8_t kept = 0U;
+        
+        for (uint8_t i = 0U; i < ta_g_running_depth; i++)
+        {
+            if (ta_g_running[i] != me)
+            {
+                ta_g_running[kept++] = ta_g_running[i];
+            }
+        }
+        ta_g_running_depth = kept;
+        #if (TA_CFG_ID_BUS == ON)
+        TA__showActive();
+        #endif
+        CyExitCriticalSection(intr);
     }
-
-    ta_g_analyzers[ta_g_analyzer_count - 1U] = NULL_PTR;
-    ta_g_analyzer_count--;
+    #endif
 
     // Reset the analyzer object itself
     memset(me, 0, sizeof(TA_t));
@@ -415,57 +815,604 @@ RC_t TA_delete(TA_t *const me)
 }
 
 /**
- * Func to calculate the elapsed ticks/cycles between start and stop time.
- * \param TA_t *const me            : [IN/OUT] struct of Analyzer related parameters
- * \return RC_SUCCESS when success
+ * Func to send name and statistics of all analyzers as binary frames (TAWire.h), the compact counterpart of TA_printAll.
+ * \param None
+ * \return RC_SUCCESS when success and RC_ERROR_BUFFER_EMTPY when analyzer array is empty
 */
-RC_t TA_calculateElapsedTime(TA_t *const me)
+RC_t TA_sendAll(void)
 {
-    RC_t res = RC_SUCCESS;
+    uint8_t payload[TA_CFG_WIRE_FRAME_SIZE];
+    TA_WireFrame_t frame;
+    TA_WireStats_t stats;
     
-    // Calculate the elapsed time
-    if (me->stop_time >= me->start_time)
+    if (ta_g_analyzer_count == 0U)
     {
-        me->elapsed_time = me->elapsed_time + (me->stop_time - me->start_time);
-    } else {
-        /* Handle 32-bit wrap-around */
-        me->elapsed_time = me->elapsed_time + ((TA_MAX_32BIT_VALUE - me->start_time) + me->stop_time + TA_COUNTER_INCREMENT);
+        return RC_ERROR_BUFFER_EMTPY;
     }
-    return res;
+    
+    (void)TAWIRE_begin(&frame, payload, sizeof(payload));
+    
+    for (uint8_t i = 0U; i < TA_MAX_ANALYZERS; i++)
+    {
+        TA_t const *const me = ta_g_analyzers[i];
+        
+        if (me == NULL_PTR)
+        {
+            continue;
+        }
+        
+        stats.id      = me->id;
+        stats.mode    = (uint8_t)me->mode;
+        stats.state   = (uint8_t)me->state;
+        stats.elapsed = (uint32_t)me->elapsed_time;      // The wire record keeps 32 bit
+        stats.count   = me->stats.count;
+        stats.min     = me->stats.min;
+        stats.max     = me->stats.max;
+        stats.mean    = TA_getMean(me);
+        stats.stddev  = TA_getStdDev(me);
+        
+        // Name and statistics of one analyzer always go into the same frame
+        if ((TAWIRE_putName(&frame, me->id, me->name) != RC_SUCCESS) || (TAWIRE_putStats(&frame, &stats) != RC_SUCCESS))
+        {
+            (void)TA_sendFrame(&frame);
+            (void)TAWIRE_putName(&frame, me->id, me->name);
+            (void)TAWIRE_putStats(&frame, &stats);
+        }
+    }
+    
+    return TA_sendFrame(&frame);
 }
 
 /**
- * Func which returns elapsed time in ms based on SysTick or DWT reading.
- * \param TA_t const *const me      : [IN] struct of Analyzer related parameters
- * \return time_ms an uint32_t variable holding calculated time in ms
+ * Func to close a binary frame and send it over UART. The frame is empty afterwards.
+ * \param TA_WireFrame_t *const frame   : [IN/OUT] frame, payload at most TA_CFG_WIRE_FRAME_SIZE
+ * \return RC_SUCCESS when success (also for an empty frame) and RC_ERROR_NULL when the frame pointer is null
 */
-uint32_t TA_getElapsedTimeInMs(TA_t *const me) // keep time_ms as global to keep the func with RC_t return type ???
+RC_t TA_sendFrame(TA_WireFrame_t *const frame)
 {
-    RC_t res = RC_SUCCESS;
+    uint8_t encoded[TAWIRE_ENCODED_SIZE(TA_CFG_WIRE_FRAME_SIZE) + 1U];
+    uint16_t length;
+    
+    if (frame == NULL_PTR)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    // Leading delimiter ends text output which may have been sent before (N13)
+    encoded[0] = TAWIRE_DELIMITER;
+    length = TAWIRE_finish(frame, &encoded[1], sizeof(encoded) - 1U);
+    if (length != 0U)
+    {
+        TA_LOG_ARRAY(encoded, length + 1U);
+    }
     
-    // Calculate the elapsed time in ms
-    uint32_t time_ms = me->elapsed_time / BCLK__BUS_CLK__KHZ; 
+    return RC_SUCCESS;
+}
 
-    return time_ms;
+/**
+ * Func which returns the analyzer with the given id, e.g. to resolve trace events.
+ * \param uint8_t const id          : [IN] analyzer id
+ * \return analyzer, NULL_PTR when no analyzer with this id exists
+*/
+TA_t *TA_getAnalyzer(uint8_t const id)
+{
+    return (id < TA_MAX_ANALYZERS) ? ta_g_analyzers[id] : NULL_PTR;
 }
 
 /**
- * Func which returns elapsed time based on SysTick or DWT reading.
- * \param TA_t *const me        : [IN] struct of Analyzer related parameters
- * \return RC_SUCCESS when success and RC_ERROR_NULL when the me pointer is null
+ * Func which returns the innermost running DWT analyzer, e.g. to attribute a sample taken by an ISR.
+ * \param None
+ * \return analyzer on top of the running stack, NULL_PTR when none runs or without TA_CFG_PREEMPTION
 */
-RC_t TA_printStatus(TA_t *const me)
+TA_t *TA_getActive(void)
+{
+#if (TA_CFG_PREEMPTION == ON)
+    uint8 intr = CyEnterCriticalSection();
+    TA_t *const active = (ta_g_running_depth != 0U) ? ta_g_running[ta_g_running_depth - 1U] : NULL_PTR;
+    
+    CyExitCriticalSection(intr);
+    return active;
+#else
+    return NULL_PTR;
+#endif
+}
+
+/**
+ * Func to calculate the elapsed ticks/cycles between start and stop time.
+ * The interval is added to raw_elapsed_time as measured and to elapsed_time with the calibrated overhead removed.
+ * \param TA_t *const me            : [IN/OUT] struct of Analyzer related parameters
+ * \return RC_SUCCESS when success
+*/
+RC_t TA_calculateElapsedTime(TA_t *const me)
 {
     RC_t res = RC_SUCCESS;
+    uint64_t interval;
+    uint32_t overhead = ta_g_overhead[me->mode];
     
-    // Validate the input
-    if (me == NULL_PTR)
+    // Calculate the elapsed time - cycle timestamps are 64 bit (N18), the ms counter wraps after 49 days
+    if (TA__countsCycles(me->mode) == FALSE)
+    {
+        interval = (uint32_t)((uint32_t)me->stop_time - (uint32_t)me->start_time);
+    } else {
+        interval = me->stop_time - me->start_time;
+    }
+    
+    // Keep the raw value, remove our own cost from the compensated one
+    me->raw_elapsed_time = me->raw_elapsed_time + interval;
+    interval             = (interval > overhead) ? (interval - overhead) : 0ULL;
+    me->elapsed_time     = me->elapsed_time + interval;
+    TA_addRunTime(me, interval);
+    
+    // Time of the analyzers which ran on top of this interval is theirs (N15)
+    me->self_time        = me->self_time + ((interval > me->child_time) ? (interval - me->child_time) : 0ULL);
+    me->child_time       = 0UL;
+    
+    return res;
+}
+
+/**
+ * Func to open a DWT interval. With TA_CFG_PREEMPTION the counter is read and the analyzer is put on
+ * the running stack in one critical section, so an ISR can not fall between the two.
+ * \param TA_t *const me            : [IN/OUT] struct of Analyzer related parameters
+ * \return None
+*/
+static void TA__openInterval(TA_t *const me)
+{
+#if (TA_CFG_PREEMPTION == ON)
+    uint8 intr = CyEnterCriticalSection();
+    
+    me->child_time = 0UL;
+    me->ctx        = (uint8_t)__get_IPSR();
+    if (ta_g_running_depth < TA_CFG_PREEMPTION_DEPTH)
+    {
+        ta_g_running[ta_g_running_depth++] = me;
+    }
+    #if (TA_CFG_ID_BUS == ON)
+    TA__showActive();
+    #endif
+    me->start_time = TA_readCycles64();
+    
+    CyExitCriticalSection(intr);
+#else
+    me->ctx        = (uint8_t)__get_IPSR();
+    me->start_time = TA_readCycles64();
+#endif
+}
+
+/**
+ * Func to close a DWT interval. With TA_CFG_PREEMPTION the analyzer leaves the running stack and its raw
+ * interval is charged to the analyzer below it, as preemption when that one runs in another context.
+ * \param TA_t *const me            : [IN/OUT] struct of Analyzer related parameters
+ * \return None
+*/
+static void TA__closeInterval(TA_t *const me)
+{
+#if (TA_CFG_PREEMPTION == ON)
+    uint8 intr = CyEnterCriticalSection();
+    uint8_t pos = ta_g_running_depth;
+    
+    me->stop_time = TA_readCycles64();
+    
+    // Normally the top entry, the search also covers stops out of order
+    while (pos > 0U)
+    {
+        pos--;
+        if (ta_g_running[pos] == me)
+        {
+            uint64_t interval = me->stop_time - me->start_time;
+            TA_t *const below = (pos > 0U) ? ta_g_running[pos - 1U] : NULL_PTR;
+            
+            for (uint8_t i = pos; (i + 1U) < ta_g_running_depth; i++)
+            {
+                ta_g_running[i] = ta_g_running[i + 1U];
+            }
+            ta_g_running_depth--;
+            #if (TA_CFG_ID_BUS == ON)
+            TA__showActive();
+            #endif
+            
+            if (below != NULL_PTR)
+            {
+                below->child_time += (uint32_t)interval;     // One interval of the region below, less than a counter period
+                if (below->ctx != me->ctx)
+                {
+                    below->preempt_count++;
+                    below->preempt_time += interval;
+                }
+            }
+            break;
+        }
+    }
+    
+    CyExitCriticalSection(intr);
+#else
+    me->stop_time = TA_readCycles64();
+#endif
+}
+
+#if (TA_CFG_ID_BUS == ON)
+/**
+ * Func to put the innermost running analyzer on the ID bus: id + 1, TA_ID_BUS_IDLE when the stack is empty.
+ * Called with interrupts locked right after the running stack changed.   (N24)
+ * \param None
+ * \return None
+*/
+static void TA__showActive(void)
+{
+    TA_ID_BUS = (ta_g_running_depth != 0U) ? (uint8_t)(ta_g_running[ta_g_running_depth - 1U]->id + 1U) : TA_ID_BUS_IDLE;
+}
+#endif
+
+/**
+ * Func to add a completed run to the analyzer's statistics and check its budget. Called by TA_stop, O(1).
+ * \param TA_t *const me            : [IN/OUT] struct of Analyzer related parameters
+ * \param uint32_t const run        : [IN] duration of the run in counter units
+ * \return None
+*/
+void TA_recordRun(TA_t *const me, uint32_t const run)
+{
+    // Distribution, one CLZ and an increment
+    if (me->hist != NULL_PTR)
+    {
+        TAHIST_record(me->hist, run);
+    }
+    
+    TA__updateStats(&me->stats, run);
+    
+    // Overrun - count, keep the evidence and signal it      (N17)
+    if ((me->budget.limit != 0UL) && (run > me->budget.limit))
+    {
+        me->budget.overruns++;
+        me->budget.last_run  = run;
+        me->budget.last_time = me->stop_time;
+        
+        if (me->budget.trigger_pin != NULL_PTR)
+        {
+            me->budget.trigger_pin(1U);
+            me->budget.trigger_pin(0U);
+        }
+        if (me->budget.hook != NULL_PTR)
+        {
+            me->budget.hook(me->id, run);
+        }
+    }
+}
+
+/**
+ * Func to add one value to a statistics set, O(1).
+ * \param TA_Stats_t *const stats   : [IN/OUT] statistics
+ * \param uint32_t const value      : [IN] value in counter units
+ * \return None
+*/
+static void TA__updateStats(TA_Stats_t *const stats, uint32_t const value)
+{
+    sint64_t sample = (sint64_t)value << TA_CFG_STATS_FRAC_BITS;
+    sint64_t delta, delta2;
+    
+    stats->count++;
+    stats->last = value;
+    
+    // First value initializes everything
+    if (stats->count == 1UL)
+    {
+        stats->min    = value;
+        stats->max    = value;
+        stats->mean_q = sample;
+        stats->m2     = 0ULL;
+        return;
+    }
+    
+    // Best/worst case
+    if (value < stats->min)
+    {
+        stats->min = value;
+    }
+    if (value > stats->max)
+    {
+        stats->max = value;
+    }
+    
+    // Welford: mean += (x - mean) / n, M2 += (x - mean_old) * (x - mean_new)      (N12)
+    delta         = sample - stats->mean_q;
+    stats->mean_q = stats->mean_q + (delta / (sint64_t)stats->count);
+    delta2        = sample - stats->mean_q;
+    stats->m2     = stats->m2 + TA__mulDeviation(delta, delta2);
+}
+
+/**
+ * Func to clear the run and period statistics, e.g. after a warm-up phase.
+ * \param TA_t *const me            : [IN/OUT] struct of Analyzer related parameters
+ * \return RC_SUCCESS when success and RC_ERROR_NULL when the me pointer is null
+*/
+RC_t TA_resetStats(TA_t *const me)
+{
+    if (me == NULL_PTR)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    memset(&me->stats, 0, sizeof(TA_Stats_t));
+    memset(&me->period.stats, 0, sizeof(TA_Stats_t));
+    me->period.max_jitter = 0UL;
+    me->period.missed     = 0UL;
+    me->budget.overruns   = 0UL;
+    me->budget.last_run   = 0UL;
+    me->budget.last_time  = 0UL;
+    (void)TAHIST_clear(me->hist);
+    
+    return RC_SUCCESS;
+}
+
+/**
+ * Func to attach a histogram to an analyzer, every following run is recorded in it. The histogram is cleared.
+ * \param TA_t *const me            : [IN/OUT] struct of Analyzer related parameters
+ * \param TA_Hist_t *const hist     : [IN] histogram owned by the caller, NULL_PTR to detach
+ * \return RC_SUCCESS when success, RC_ERROR_NULL when the me pointer is null and
+ *         RC_ERROR_BAD_PARAM for TA_MODE_PIN (no measured runs)
+*/
+RC_t TA_attachHistogram(TA_t *const me, TA_Hist_t *const hist)
+{
+    if (me == NULL_PTR)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    if (me->mode == TA_MODE_PIN)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+    
+    (void)TAHIST_clear(hist);
+    me->hist = hist;
+    
+    return RC_SUCCESS;
+}
+
+/**
+ * Func which returns a percentile of the run durations, see TAHIST_getPercentile.
+ * \param TA_t const *const me      : [IN] struct of Analyzer related parameters
+ * \param uint16_t const permyriad  : [IN] percentile in 1/10000, e.g. TAHIST_P99
+ * \return value in counter units, 0 without histogram or runs
+*/
+uint32_t TA_getPercentile(TA_t const *const me, uint16_t const permyriad)
+{
+    return TAHIST_getPercentile(me->hist, permyriad);
+}
+
+/**
+ * Func which returns the mean run duration.
+ * \param TA_t const *const me      : [IN] struct of Analyzer related parameters
+ * \return mean in counter units, rounded, 0 without runs
+*/
+uint32_t TA_getMean(TA_t const *const me)
+{
+    return TA__getStatsMean(&me->stats);
+}
+
+/**
+ * Func which returns the rounded mean of a statistics set.
+ * \param TA_Stats_t const *const stats     : [IN] statistics
+ * \return mean in counter units
+*/
+static uint32_t TA__getStatsMean(TA_Stats_t const *const stats)
+{
+    return (uint32_t)((stats->mean_q + TA_STATS_ROUND) >> TA_CFG_STATS_FRAC_BITS);
+}
+
+/**
+ * Func to enable the activation period tracking: every TA_start records the interval to the previous start. Clears the period statistics.
+ * \param TA_t *const me            : [IN/OUT] struct of Analyzer related parameters
+ * \param uint32_t const nominal    : [IN] expected period in counter units (DWT cycles, SysTick ms or bus cycles with TA_CFG_SYSTICK_SUBMS), 0 disables the tracking
+ * \return RC_SUCCESS when success, RC_ERROR_NULL when the me pointer is null and
+ *         RC_ERROR_BAD_PARAM for TA_MODE_PIN (no counter)
+*/
+RC_t TA_setPeriod(TA_t *const me, uint32_t const nominal)
+{
+    if (me == NULL_PTR)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    if (me->mode == TA_MODE_PIN)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+    
+    memset(&me->period, 0, sizeof(TA_Period_t));
+    me->period.nominal = nominal;
+    
+    return RC_SUCCESS;
+}
+
+/**
+ * Func to set an execution budget: every completed run longer than the budget counts as overrun,
+ * calls the hook and pulses the trigger pin. Clears the overrun counter.
+ * \param TA_t *const me                    : [IN/OUT] struct of Analyzer related parameters
+ * \param uint32_t const limit              : [IN] budget in counter units (DWT cycles, see TA_BUDGET_US, or SysTick ms without TA_CFG_SYSTICK_SUBMS), 0 removes it
+ * \param TA_OverrunHook_t const hook       : [IN] called on every overrun, NULL_PTR for none
+ * \param TA_PinFunc_t const trigger_pin    : [IN] pin pulsed on every overrun, NULL_PTR for none
+ * \return RC_SUCCESS when success, RC_ERROR_NULL when the me pointer is null and
+ *         RC_ERROR_BAD_PARAM for TA_MODE_PIN (no measured runs)
+*/
+RC_t TA_setBudget(TA_t *const me, uint32_t const limit, TA_OverrunHook_t const hook, TA_PinFunc_t const trigger_pin)
+{
+    if (me == NULL_PTR)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    if (me->mode == TA_MODE_PIN)
+    {
+        return RC_ERROR_BAD_PARAM;
+    }
+    
+    memset(&me->budget, 0, sizeof(TA_Budget_t));
+    me->budget.limit       = limit;
+    me->budget.hook        = hook;
+    me->budget.trigger_pin = trigger_pin;
+    
+    // Trigger idles low
+    if (trigger_pin != NULL_PTR)
+    {
+        trigger_pin(0U);
+    }
+    
+    return RC_SUCCESS;
+}
+
+/**
+ * Func which returns the mean start-to-start period, see TA_setPeriod.
+ * \param TA_t const *const me      : [IN] struct of Analyzer related parameters
+ * \return mean period in counter units, 0 before the second start
+*/
+uint32_t TA_getPeriodMean(TA_t const *const me)
+{
+    return TA__getStatsMean(&me->period.stats);
+}
+
+/**
+ * Func to record the interval since the previous TA_start, called at the beginning of TA_start.    (N16)
+ * \param TA_t *const me            : [IN/OUT] struct of Analyzer related parameters, period tracking enabled
+ * \return None
+*/
+static void TA__recordPeriod(TA_t *const me)
+{
+    TA_Period_t *const period = &me->period;
+    uint32_t now = ((TA_MODE_SYSTICK == me->mode) || (TA_MODE_SYSTICK_PIN == me->mode)) ? (uint32_t)TA_readSysTick() : DWT->CYCCNT;
+    uint32_t interval = now - period->last_start;      // Unsigned subtraction covers one counter wrap
+    uint32_t activations;
+    
+    period->last_start = now;
+    
+    // The first start has no predecessor
+    if (period->has_start == FALSE)
+    {
+        period->has_start = TRUE;
+        return;
+    }
+    
+    TA__updateStats(&period->stats, interval);
+    
+    // Number of nominal periods, rounded - more than one means activations were missed
+    activations = (interval + (period->nominal / 2UL)) / period->nominal;
+    if (activations > 1UL)
+    {
+        period->missed += activations - 1UL;
+    }
+    else
+    {
+        uint32_t jitter = (interval > period->nominal) ? (interval - period->nominal) : (period->nominal - interval);
+        
+        if (jitter > period->max_jitter)
+        {
+            period->max_jitter = jitter;
+        }
+    }
+}
+
+/**
+ * Func which returns the sample variance of the run durations.
+ * \param TA_t const *const me      : [IN] struct of Analyzer related parameters
+ * \return variance in counter units^2, 0 with less than 2 runs
+*/
+uint64_t TA_getVariance(TA_t const *const me)
+{
+    if (me->stats.count < 2UL)
+    {
+        return 0ULL;
+    }
+    
+    return me->stats.m2 / (uint64_t)(me->stats.count - 1UL);
+}
+
+/**
+ * Func which returns the standard deviation (jitter) of the run durations.
+ * \param TA_t const *const me      : [IN] struct of Analyzer related parameters
+ * \return standard deviation in counter units, 0 with less than 2 runs
+*/
+uint32_t TA_getStdDev(TA_t const *const me)
+{
+    return TA__sqrt(TA_getVariance(me));
+}
+
+/**
+ * Func to multiply the two Welford deviations (fixed point) into unit^2.
+ * Both always have the same sign. Large deviations lose the fractional bits instead of overflowing.
+ * \param sint64_t const delta      : [IN] sample - old mean, fixed point
+ * \param sint64_t const delta2     : [IN] sample - new mean, fixed point
+ * \return product in unit^2
+*/
+static uint64_t TA__mulDeviation(sint64_t const delta, sint64_t const delta2)
+{
+    uint64_t a = (uint64_t)((delta < 0LL) ? -delta : delta);
+    uint64_t b = (uint64_t)((delta2 < 0LL) ? -delta2 : delta2);
+    
+    if ((a < TA_STATS_EXACT_LIMIT) && (b < TA_STATS_EXACT_LIMIT))
+    {
+        return (a * b) >> (2U * TA_CFG_STATS_FRAC_BITS);
+    }
+    return (a >> TA_CFG_STATS_FRAC_BITS) * (b >> TA_CFG_STATS_FRAC_BITS);
+}
+
+/**
+ * Func integer square root (bitwise, no FPU).
+ * \param uint64_t value            : [IN] radicand
+ * \return floor(sqrt(value))
+*/
+static uint32_t TA__sqrt(uint64_t value)
+{
+    uint64_t root = 0ULL;
+    uint64_t bit  = 1ULL << 62U;
+    
+    while (bit > value)
+    {
+        bit >>= 2U;
+    }
+    while (bit != 0ULL)
+    {
+        if (value >= (root + bit))
+        {
+            value -= root + bit;
+            root   = (root >> 1U) + bit;
+        } else {
+            root >>= 1U;
+        }
+        bit >>= 2U;
+    }
+    return (uint32_t)root;
+}
+
+/**
+ * Func which returns elapsed time in ms based on SysTick or DWT reading.
+ * \param TA_t const *const me      : [IN] struct of Analyzer related parameters
+ * \return time_ms an uint32_t variable holding calculated time in ms
+*/
+uint32_t TA_getElapsedTimeInMs(TA_t *const me) // keep time_ms as global to keep the func with RC_t return type ???
+{
+    // Calculate the elapsed time in ms, SysTick without TA_CFG_SYSTICK_SUBMS already counts ms
+    uint32_t time_ms = (TA__countsCycles(me->mode) == TRUE) ? (uint32_t)(me->elapsed_time / BCLK__BUS_CLK__KHZ) : (uint32_t)me->elapsed_time; 
+
+    return time_ms;
+}
+
+/**
+ * Func which returns elapsed time based on SysTick or DWT reading.
+ * \param TA_t *const me        : [IN] struct of Analyzer related parameters
+ * \return RC_SUCCESS when success and RC_ERROR_NULL when the me pointer is null
+*/
+RC_t TA_printStatus(TA_t *const me)
+{
+    RC_t res = RC_SUCCESS;
+    
+    // Validate the input
+    if (me == NULL_PTR)
     {
         return RC_ERROR_NULL;
     }
     
     // Buffer to assemble string
     char buffer[150]; 
+    char number[2U][TA_U64_DIGITS];     // 64 bit values, see TA_formatU64
 
     // Format state as string
     const char* strState;
@@ -489,29 +1436,142 @@ RC_t TA_printStatus(TA_t *const me)
     }    
     
     // Assemble full status string
-    if(me->mode == TA_MODE_DWT || me->mode == TA_MODE_DWT_PIN)
+    if (TA__countsCycles(me->mode) == TRUE)
     {
-        uint32_t int_ms, frac_ms, rem_cycles;
-        int_ms = me->elapsed_time / BCLK__BUS_CLK__KHZ;
-        rem_cycles = me->elapsed_time % BCLK__BUS_CLK__KHZ;
+        char int_ms[TA_U64_DIGITS];
+        uint32_t frac_ms, rem_cycles;
+        (void)TA_formatU64(int_ms, sizeof(int_ms), me->elapsed_time / BCLK__BUS_CLK__KHZ);
+        rem_cycles = (uint32_t)(me->elapsed_time % BCLK__BUS_CLK__KHZ);
         frac_ms = (rem_cycles * TA_SCALE_FACTOR) / BCLK__BUS_CLK__KHZ;
         
-        snprintf(buffer, sizeof(buffer), "Name: %s | State: %s | Elapsed time: %u.%06ums | Cycles: %u\r\n",
-             me->name, strState, int_ms, frac_ms, me->elapsed_time);
+        snprintf(buffer, sizeof(buffer), "Name: %s | State: %s | Elapsed time: %s.%06lums | Cycles: %s (raw %s)\r\n",
+             me->name, strState, int_ms, (unsigned long)frac_ms,
+             TA_formatU64(number[0], TA_U64_DIGITS, me->elapsed_time), TA_formatU64(number[1], TA_U64_DIGITS, me->raw_elapsed_time));
     } else if(me->mode == TA_MODE_PIN) {
         snprintf(buffer, sizeof(buffer), "Name: %s | State: %s\r\n", // N10
             me->name, strState);
     } else {
-        snprintf(buffer, sizeof(buffer), "Name: %s | State: %s | Elapsed time: %lums\r\n",
-            me->name, strState, me->elapsed_time);
+        snprintf(buffer, sizeof(buffer), "Name: %s | State: %s | Elapsed time: %sms\r\n",
+            me->name, strState, TA_formatU64(number[0], TA_U64_DIGITS, me->elapsed_time));
     }
 
     // Send string to UART
-    UART_LOG_PutString(buffer);
+    TA_LOG_STRING(buffer);
+    
+    // Run statistics, not available for external (pin only) measurements
+    if ((me->mode != TA_MODE_PIN) && (me->stats.count != 0UL))
+    {
+        const char* strUnit = (TA__countsCycles(me->mode) == TRUE) ? "cycles" : "ms";
+        
+        snprintf(buffer, sizeof(buffer), "      Runs: %lu | Last: %lu | Min: %lu | Max: %lu | Mean: %lu | StdDev: %lu %s\r\n",
+            (unsigned long)me->stats.count, (unsigned long)me->stats.last, (unsigned long)me->stats.min,
+            (unsigned long)me->stats.max, (unsigned long)TA_getMean(me), (unsigned long)TA_getStdDev(me), strUnit);
+        TA_LOG_STRING(buffer);
+        
+        // Only analyzers which went through the running stack (not the inline API of TimingAnalyzer_fast.h)
+        if ((me->self_time != 0ULL) || (me->preempt_count != 0UL))
+        {
+            snprintf(buffer, sizeof(buffer), "      Self: %s | Preempted: %lu times, %s %s\r\n",
+                TA_formatU64(number[0], TA_U64_DIGITS, me->self_time), (unsigned long)me->preempt_count,
+                TA_formatU64(number[1], TA_U64_DIGITS, me->preempt_time), strUnit);
+            TA_LOG_STRING(buffer);
+        }
+        
+        if (me->budget.limit != 0UL)
+        {
+            snprintf(buffer, sizeof(buffer), "      Budget: %lu | Overruns: %lu | Last overrun: %lu at %s %s\r\n",
+                (unsigned long)me->budget.limit, (unsigned long)me->budget.overruns, (unsigned long)me->budget.last_run,
+                TA_formatU64(number[0], TA_U64_DIGITS, me->budget.last_time), strUnit);
+            TA_LOG_STRING(buffer);
+        }
+        
+        if (me->period.stats.count != 0UL)
+        {
+            snprintf(buffer, sizeof(buffer), "      Period: nominal %lu | Min: %lu | Max: %lu | Mean: %lu | Jitter: %lu | Missed: %lu %s\r\n",
+                (unsigned long)me->period.nominal, (unsigned long)me->period.stats.min, (unsigned long)me->period.stats.max,
+                (unsigned long)TA_getPeriodMean(me), (unsigned long)me->period.max_jitter, (unsigned long)me->period.missed, strUnit);
+            TA_LOG_STRING(buffer);
+        }
+        
+        if (me->hist != NULL_PTR)
+        {
+            snprintf(buffer, sizeof(buffer), "      P50: %lu | P90: %lu | P99: %lu | P99.9: %lu %s\r\n",
+                (unsigned long)TA_getPercentile(me, TAHIST_P50), (unsigned long)TA_getPercentile(me, TAHIST_P90),
+                (unsigned long)TA_getPercentile(me, TAHIST_P99), (unsigned long)TA_getPercentile(me, TAHIST_P999), strUnit);
+            TA_LOG_STRING(buffer);
+        }
+    }
     
     return res;
 }
 
+/**
+ * Func to ask for a TA_printStatus of this analyzer outside the caller's context. Costs one store,
+ * so it can be used in ISRs; the text is formatted later by TA_processPrints.
+ * \param TA_t *const me            : [IN/OUT] struct of Analyzer related parameters
+ * \return RC_SUCCESS when success and RC_ERROR_NULL when the me pointer is null
+*/
+RC_t TA_requestPrint(TA_t *const me)
+{
+    if (me == NULL_PTR)
+    {
+        return RC_ERROR_NULL;
+    }
+    
+    __atomic_store_n(&me->print_request, TRUE, __ATOMIC_RELEASE);
+    
+    #if (TA_CFG_PRINT_PENDSV == ON)
+    SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+    #endif
+    
+    return RC_SUCCESS;
+}
+
+/**
+ * Func to print all analyzers with a pending TA_requestPrint. Background worker, call it from the
+ * idle loop (or it runs in PendSV with TA_CFG_PRINT_PENDSV ON).
+ * \param None
+ * \return RC_SUCCESS when at least one analyzer was printed and RC_ERROR_BUFFER_EMTPY when nothing was pending
+*/
+RC_t TA_processPrints(void)
+{
+    RC_t res = RC_ERROR_BUFFER_EMTPY;
+    
+    for (uint8_t i = 0U; i < TA_MAX_ANALYZERS; i++)
+    {
+        TA_t *me = ta_g_analyzers[i];
+        
+        // Take the request first, a new one arriving while printing is served next time
+        if ((me != NULL_PTR) && (__atomic_exchange_n(&me->print_request, FALSE, __ATOMIC_ACQUIRE) != FALSE))
+        {
+            TA_t snapshot;
+            uint8 intr;
+            
+            // Consistent copy, the owning ISR may record a run in between      (N14)
+            intr = CyEnterCriticalSection();
+            snapshot = *me;
+            CyExitCriticalSection(intr);
+            
+            (void)TA_printStatus(&snapshot);
+            res = RC_SUCCESS;
+        }
+    }
+    
+    return res;
+}
+
+#if (TA_CFG_PRINT_PENDSV == ON)
+/**
+ * Func PendSV handler - runs the deferred prints once no other exception is active
+ * \param None
+ * \return None
+*/
+static void TA__pendSvHandler(void)
+{
+    (void)TA_processPrints();
+}
+#endif
+
 /**
  * Func to print all the available Analysers
  * \param None
@@ -523,10 +1583,14 @@ RC_t TA_printAll(void)
     
     boolean_t anyActive = FALSE;
     
-    for (uint8_t i = 0; i < ta_g_analyzer_count; i++)
+    for (uint8_t i = 0; i < TA_MAX_ANALYZERS; i++)
     {
         TA_t *me = ta_g_analyzers[i];
-        if ((me != NULL_PTR) && me->state)
+        if (me == NULL_PTR)
+        {
+            continue;       // Free id
+        }
+        if (me->state)
         {
             anyActive = TRUE;
             TA_printStatus(me);
@@ -539,13 +1603,93 @@ RC_t TA_printAll(void)
     if (anyActive == FALSE)
     {
         // Array is empty
-        UART_LOG_PutString("\r\nInfo: No analyzer instance available to print.\r\n");
+        TA_LOG_STRING("\r\nInfo: No analyzer instance available to print.\r\n");
         
         res = RC_ERROR_BUFFER_EMTPY;
     }  
     return res;
 }
 
+/**
+ * Func to switch instrumentation categories on at runtime. Atomic, callable from any context.
+ * \param uint32_t const categories    : [IN] TA_CAT_* bits
+ * \return None
+*/
+void TA_enableCategories(uint32_t const categories)
+{
+    (void)__atomic_fetch_or(&ta_g_enable_mask, categories, __ATOMIC_RELAXED);
+}
+
+/**
+ * Func to switch instrumentation categories off at runtime. Atomic, callable from any context.
+ * A region already started stays open, change the mask between runs.
+ * \param uint32_t const categories    : [IN] TA_CAT_* bits
+ * \return None
+*/
+void TA_disableCategories(uint32_t const categories)
+{
+    (void)__atomic_fetch_and(&ta_g_enable_mask, ~categories, __ATOMIC_RELAXED);
+}
+
+/**
+ * Func which returns the DWT cycle counter extended to 64 bit by its wrap epoch. Monotonic and callable
+ * from any context, as long as it (or any DWT measurement, SysTick_Handler, TALOAD_idle) runs at least
+ * once per half counter period (~89s at 24MHz).
+ * \param None
+ * \return cycles since TA_init
+*/
+uint64_t TA_getCycles64(void)
+{
+    return TA_readCycles64();
+}
+
+/**
+ * Func which returns the ms since TA_init, derived on demand from the 64 bit DWT counter (no SysTick needed).
+ * \param None
+ * \return milliseconds since TA_init
+*/
+uint32_t TA_getSystemMs(void)
+{
+    return (uint32_t)(TA_readCycles64() / BCLK__BUS_CLK__KHZ);
+}
+
+/**
+ * Func to format a 64 bit counter value as decimal, printf of newlib-nano has no %llu.
+ * \param char *const buffer           : [OUT] text, at least TA_U64_DIGITS bytes for every value
+ * \param uint8_t const size           : [IN] size of the buffer
+ * \param uint64_t value               : [IN] value
+ * \return buffer, an empty string when the value does not fit
+*/
+char *TA_formatU64(char *const buffer, uint8_t const size, uint64_t value)
+{
+    char digits[TA_U64_DIGITS];
+    uint8_t count = 0U;
+    
+    // Digits from the lowest one, at least one digit for 0
+    do
+    {
+        digits[count++] = (char)('0' + (value % 10ULL));
+        value /= 10ULL;
+    } while (value != 0ULL);
+    
+    if (count >= size)
+    {
+        if (size != 0U)
+        {
+            buffer[0] = '\0';
+        }
+        return buffer;
+    }
+    
+    for (uint8_t i = 0U; i < count; i++)
+    {
+        buffer[i] = digits[count - 1U - i];
+    }
+    buffer[count] = '\0';
+    
+    return buffer;
+}
+
 /**
  * Func Systick Handler - used to increment the milliseconds counter each millisecond
  * \param None
@@ -553,7 +1697,16 @@ RC_t TA_printAll(void)
 */
 void SysTick_Handler(void)
 {
+    uint8 intr = CyEnterCriticalSection();
+    
+    // Count the ms and consume its reload in one step, TA_readSysTick may run in between otherwise (N19)
+    (void)CySysTickGetCountFlag();
     ta_g_system_ms++;
+    ta_g_systick_reload = FALSE;
+    CyExitCriticalSection(intr);
+    
+    // Keeps the wrap epoch of the DWT counter current without any measurement running (N18)
+    (void)TA_readCycles64();
 }
 
 /* NOTE
@@ -584,6 +1737,117 @@ void SysTick_Handler(void)
  *
  * 10. snprintf - avoids buffer overflow.
  *
+ * 11. Self-overhead - in DWT modes each interval contains the tail of TA_start/TA_resume after the
+ * counter read and the head of TA_stop/TA_pause before it. TA_calibrate measures this with an empty
+ * region; elapsed_time is compensated, raw_elapsed_time keeps the measured value.
+ *
+ * 12. Welford's online algorithm - numerically stable mean/variance in one pass without storing
+ * samples. The mean is kept with fractional bits, otherwise the integer truncation of
+ * delta / n would bias it towards the first runs.
+ *
+ * 13. Text (TA_printStatus) and binary frames (TA_sendAll, TATRACE_sendAll) may share the UART.
+ * Text contains no 0x00, so without the extra delimiter it would be taken as the start of the
+ * next frame and make its CRC fail. The receiver skips the resulting empty frames.
+ *
+ * 14. Deferred printing - snprintf and the output of TA_printStatus take far longer than the code
+ * they report on. TA_requestPrint only sets a flag, TA_processPrints formats later from the idle
+ * loop or from PendSV, which has the lowest priority and therefore never delays another ISR. The
+ * worker prints a copy taken with interrupts off, so min/max/mean of one line belong together.
+ *
+ * 15. Preemption accounting - interrupts nest strictly, so one global stack of the running DWT
+ * analyzers describes all contexts: the top entry is the innermost region. When an analyzer closes
+ * an interval, its raw duration is added to child_time of the entry below (an ISR preempting main,
+ * or a region nested with TA_start). The entry below subtracts it from its own interval, which gives
+ * self_time next to the inclusive elapsed_time. The interrupt entry/exit itself (~12 cycles each way)
+ * is not covered by any analyzer and stays in the self time of the preempted one.
+ *
+ * 16. Activation period - the start-to-start interval is taken with its own counter read at the
+ * beginning of TA_start, so it costs nothing inside the measured interval; the constant offset to
+ * the interval start cancels out between two starts. An interval of about n nominal periods means
+ * n-1 activations were missed (e.g. the ISR was blocked longer than one period); such intervals
+ * count as missed instead of as jitter, so the jitter stays the deviation of the on-time activations.
+ *
+ * 17. Budget overrun - checked in TA_recordRun, so both the runtime API and the inline macros of
+ * TimingAnalyzer_fast.h are covered, after the interval is closed. The trigger pin pulse is two pin
+ * writes long (a few 100ns), enough for the edge trigger of a logic analyzer. The hook runs in the
+ * context of TA_stop (possibly an ISR), keep it short, e.g. TA_requestPrint.
+ *
+ * 18. 64 bit cycle counter - CYCCNT wraps every 2^32 cycles (~179s at 24MHz). ta_g_cycles_state
+ * holds the number of wraps (bits 31..1) and the MSB of the counter at the last read (bit 0). A read
+ * which sees the MSB fall from 1 to 0 has found a wrap and increments the epoch. This needs a read in
+ * every half period (~89s), SysTick_Handler provides one every ms. The state is only written when
+ * the MSB has changed and the write is a compare-and-swap (LDREX/STREX on the Cortex-M3), so an ISR
+ * which reads the counter in between can not make the interrupted read count the same wrap twice;
+ * the interrupted read then simply repeats with the new state. Timestamps and the elapsed/self/
+ * preemption accumulators are 64 bit, run_time and the statistics stay 32 bit (one run < 179s).
+ *
+ * 19. Sub-ms SysTick - the SysTick counts down from LOAD to 0 and reloads, the ms counter is
+ * incremented by its handler. Time = ms * (LOAD + 1) + (LOAD - VAL). With interrupts off the
+ * handler can not run between the reads, but the counter can still reload, and the ms counter is
+ * one behind from the reload until the handler has counted it. The pending bit (ICSR.PENDSTSET)
+ * does not show this: it is cleared on exception entry, while the ms counter is only incremented
+ * when CySysTickServiceCallbacks reaches our callback. Other SysTick callbacks before it, or a
+ * higher priority ISR preempting the handler, would read a reloaded VAL with the old ms - one ms
+ * early, time going backwards. The COUNTFLAG of SysTick->CTRL is set by the reload itself and only
+ * cleared by reading CTRL, so it stays set until somebody looks. TA_readSysTick reads it after VAL
+ * and latches it in ta_g_systick_reload, because the read clears it for the next caller;
+ * SysTick_Handler consumes flag and latch together with its increment in one critical section.
+ * When the flag is seen, VAL is read again, so it surely belongs to the new ms. The application
+ * must not read SysTick->CTRL itself (CySysTickGetCountFlag), that would hide a reload. Without
+ * DWT this gives bus clock resolution, at the cost of four register reads and a short critical
+ * section per timestamp; it stays a 1 ms time base for the OS.
+ *
+ * 20. Tickless - with TA_CFG_TICKLESS the SysTick (1000 interrupts per second, the OS tick and a
+ * wake-up source in sleep) runs only while a SysTick analyzer exists; TA_create and TA_delete count
+ * them. Wall time comes from the 64 bit DWT counter instead (TA_getSystemMs), which needs no
+ * interrupt at all. Its wrap epoch then has to be refreshed by other means at least every ~89s:
+ * every DWT measurement, TALOAD_idle and TA_getSystemMs/TA_getCycles64 do it. ta_g_system_ms only
+ * counts while the SysTick runs, it is the base of the SysTick modes and not a wall clock.
+ *
+ * 21. Registry - the id of an analyzer is its index into ta_g_analyzers, so TA_getAnalyzer, the
+ * trace and the wire records resolve an id without a search. Released ids form a singly linked
+ * list through ta_g_free_next (LIFO), ids which were never used are taken from ta_g_ids_issued, so
+ * the zero-initialized state needs no setup and create/delete are O(1). The pool entry n of
+ * TA_createHandle has id n as well, the handle is simply that id. Iterations (TA_printAll, ...) run
+ * over all ids in id order and skip the free ones.
+ *
+ * 22. Instrumentation switch - TA_IF_ENABLED(cat, call) costs a load of ta_g_enable_mask, a test
+ * against the constant category and a branch (2-3 cycles) when the category is off; the call and its
+ * arguments are not evaluated then. With TA_CFG_ENABLE OFF the guard and the macros of
+ * TimingAnalyzer_fast.h are empty, so instrumented code compiles as if it was not instrumented.
+ * A category switched off between start and stop leaves its analyzer RUNNING: the next TA_start is
+ * rejected with RC_ERROR_BUSY and the following TA_stop records one run which is too long. Switched
+ * on between them, TA_stop reports RC_ERROR_INVALID_STATE. The inline macros have no state check at
+ * all, so change the mask only between runs.
+ *
+ * 23. Scope measurement - between the two counter reads TA_SCOPE runs the same code as
+ * TA_START_DWT/TA_STOP_DWT, so it is measured with the same calibrated overhead. The first pass check
+ * (name still NULL_PTR) is before the start, the cleanup function or destructor is inlined at every
+ * exit of the block. The static analyzer belongs to the source line, not to a call: a recursive call
+ * or the same function running in main and in an ISR restarts it while it is running, like two
+ * TA_START_DWT in a row. Should the registry be full, the scope is still measured but not listed;
+ * the create is not repeated on every pass.
+ *
+ * 24. ID bus - the 8 lines carry id + 1 of the analyzer on top of the running stack, so one logic
+ * analyzer capture with a parallel bus decoder shows which of up to 255 regions runs and when an
+ * ISR region preempts another, without one pin per analyzer. The value is written with a single
+ * byte store to a port data register or a Control Register: all lines change on the same clock
+ * edge, there are no intermediate values as with one pin write per bit, and no read-modify-write
+ * which an ISR could interleave. The store is done with interrupts locked while the stack changes,
+ * so the bus always matches the stack. It is part of the calibrated start/stop cost (N11).
+ * Analyzers of TimingAnalyzer_fast.h (no running stack), pin-only and SysTick modes do not appear
+ * on the bus. The calibration probe of TA_init has TA_ID_NONE (0xFF), which shows as 0, idle.
+ *
+ * 25. Pin edges - with TA_CFG_PIN_EDGES every pin write of TA_start/pause/resume/stop is followed by
+ * a trace event, whose DWT timestamp is taken a fixed number of cycles after the store to the port
+ * (return from the pin function, entry of TATRACE_record). Both edge directions take the same path,
+ * so the offset to the real edge is the same for both. ta_correlate aligns these timestamps with a
+ * logic analyzer capture of the pins, which shows the jitter between CPU time and pin, and whether
+ * internal and external pulse widths agree. In the DWT pin modes the record lies between the pin
+ * write and the counter read, outside the measured interval, which makes the pulse about one
+ * TATRACE_record longer than the measured run. Set TA_CFG_PIN_EDGES OFF when that matters more
+ * than the edges. The inline pin macros of TimingAnalyzer_fast.h record the edges the same way.
+ *
  * > MISRA-C:2004 compliancy - ~85–90%
  */
 
@@ -74,12 +74,60 @@
 #define TIMINGANALYZER_H
 
 #include "global.h"
+#include "TimingAnalyzer_config.h"
+#include "TAHist.h"
+#include "TAWire.h"
+#include "LogDma.h"
 
 /*****************************************************************************/
 /* Global pre-processor symbols/macros and type declarations                 */
 /*****************************************************************************/
 
 //####################### Defines/Macros
+#define TA_ID_NONE                  (0xFFU)     // Id of an analyzer which is not registered
+#define TA_MAX_ANALYZERS            (TA_CFG_MAX_ANALYZERS)  // Registered analyzers, ids are 0 .. TA_MAX_ANALYZERS-1
+
+#define TA_U64_DIGITS               (21U)       // Buffer size for TA_formatU64 (20 digits + terminator)
+#define TA_BUDGET_US(us)            ((uint32_t)(us) * BCLK__BUS_CLK__MHZ)   // Budget in us for the DWT modes, needs project.h
+
+#if (TA_CFG_MAX_ANALYZERS > TA_ID_NONE) || (TA_CFG_MAX_ANALYZERS == 0U)
+#error "TA_CFG_MAX_ANALYZERS must be 1 .. 255, the id 0xFF is TA_ID_NONE"
+#endif
+
+#if (TA_CFG_ID_BUS == ON) && (TA_CFG_PREEMPTION == OFF)
+#error "TA_CFG_ID_BUS shows the top of the running stack, it needs TA_CFG_PREEMPTION"
+#endif
+
+/* Instrumentation categories, one bit each in ta_g_enable_mask */
+#define TA_CAT_ISR                  (1UL << 0U)     // Interrupt service routines
+#define TA_CAT_TASK                 (1UL << 1U)     // Tasks and the main loop
+#define TA_CAT_DRIVER               (1UL << 2U)     // Driver and BSW calls
+#define TA_CAT_MATH                 (1UL << 3U)     // Computation kernels
+#define TA_CAT_USER                 (1UL << 4U)     // First free bit, application categories from here on
+#define TA_CAT_ALL                  (0xFFFFFFFFUL)
+
+/* Instrumentation guard, e.g. TA_IF_ENABLED(TA_CAT_ISR, TA_START_DWT(me)). Off: the call is not even compiled  (N22) */
+#if (TA_CFG_ENABLE == ON)
+#define TA_ENABLED(cat)             ((ta_g_enable_mask & (uint32_t)(cat)) != 0UL)
+#define TA_IF_ENABLED(cat, call)    do { if (TA_ENABLED(cat)) { call; } } while (0)
+#else
+#define TA_ENABLED(cat)             (FALSE)
+#define TA_IF_ENABLED(cat, call)    do { } while (0)
+#endif
+
+/* Output of all print/send functions, queued by LogDma.c or written directly to UART_LOG */
+#if (TA_CFG_LOG_DMA == ON)
+#define TA_LOG_STRING(str)          ((void)LogDma_PutString(str))
+#define TA_LOG_ARRAY(data, length)  ((void)LogDma_PutArray((data), (uint16_t)(length)))
+#define TA_LOG_STRING_WAIT(str)     ((void)LogDma_PutStringWait(str))      // Reports larger than the ring, main context only
+#else
+#define TA_LOG_STRING(str)          UART_LOG_PutString(str)
+#define TA_LOG_ARRAY(data, length)  UART_LOG_PutArray((data), (uint8_t)(length))
+#define TA_LOG_STRING_WAIT(str)     UART_LOG_PutString(str)
+#endif
+
+/* Knuth's multiplicative hash, spreads code addresses over the tables of TAProf.c and TASample.c */
+#define TA_HASH_MUL                 (2654435761UL)
     
 //####################### Enumerations
 /**
@@ -90,7 +138,7 @@
  enum eMode{
   TA_MODE_DWT,             /**< \DWT Cycle Counter. */
   TA_MODE_DWT_PIN,         /**< \DWT Cycle Counter + Output pin. */
-  TA_MODE_SYSTICK,         /**< \SYSTICK timer (1ms tick). */
+  TA_MODE_SYSTICK,         /**< \SYSTICK timer (1ms tick, bus clock resolution with TA_CFG_SYSTICK_SUBMS). */
   TA_MODE_SYSTICK_PIN,     /**< \SYSTICK + Output pin config. */
   TA_MODE_PIN              /**< \Output pin only (external measurement). */
 } ;
@@ -109,8 +157,54 @@ typedef enum eMode TA_Mode_t;
 } TA_State_t;
 
 typedef void (*TA_PinFunc_t)(uint8_t state);  /* Function ptr to pins */
+typedef void (*TA_OverrunHook_t)(uint8_t id, uint32_t run);  /* Called on a budget overrun with analyzer id and run duration */
+typedef uint8_t TA_Handle_t;                  /* Analyzer id, as handed out by TA_createHandle */
 
 //####################### Structures
+/**
+* \Run statistics struct
+*
+* Statistics over all completed runs (TA_start .. TA_stop, pauses excluded) of one analyzer, updated in O(1)
+* by TA_stop with Welford's algorithm in integer/fixed point arithmetic (no FPU needed).
+* Unit is the analyzer's counter unit: DWT cycles or SysTick ms (bus cycles with TA_CFG_SYSTICK_SUBMS).
+*/
+typedef struct {
+    uint32_t count;                 // Number of completed runs
+    uint32_t last;                  // Duration of the last run
+    uint32_t min;                   // Shortest run (best case)
+    uint32_t max;                   // Longest run (observed worst case execution time)
+    sint64_t mean_q;                // Running mean, fixed point with TA_CFG_STATS_FRAC_BITS fractional bits
+    uint64_t m2;                    // Sum of squared deviations from the mean (Welford), in unit^2
+} TA_Stats_t;
+
+/**
+* \Activation period struct
+*
+* Start-to-start intervals of an analyzer, enabled with TA_setPeriod. Unit is the analyzer's counter unit.
+*/
+typedef struct {
+    uint32_t nominal;               // Expected start-to-start period, 0 = period tracking off
+    uint32_t last_start;            // Counter value at the previous TA_start
+    boolean_t has_start;            // FALSE until the first TA_start after TA_setPeriod
+    TA_Stats_t stats;               // Statistics of the measured periods
+    uint32_t max_jitter;            // Largest |period - nominal| of the periods without missed activations
+    uint32_t missed;                // Activations missed in total (period of about n nominal periods = n-1 missed)
+} TA_Period_t;
+
+/**
+* \Execution budget struct
+*
+* Longest allowed run of an analyzer, enabled with TA_setBudget. Checked for every completed run.
+*/
+typedef struct {
+    uint32_t limit;                 // Budget in counter units, 0 = no budget
+    uint32_t overruns;              // Number of runs longer than the budget
+    uint32_t last_run;              // Duration of the last overrun
+    uint64_t last_time;             // Time the last overrun was stopped (counter value, also when stopped from TA_STATE_PAUSED)
+    TA_OverrunHook_t hook;          // Called on every overrun, NULL_PTR = none
+    TA_PinFunc_t trigger_pin;       // Pulsed on every overrun (logic analyzer trigger), NULL_PTR = none
+} TA_Budget_t;
+
 /**
 * \Analyzer instance struct
 *
@@ -121,14 +215,32 @@ typedef struct {
     const char *name;               // String name for print/log    // warning ta_name?
     TA_Mode_t mode;                 // Selected measurement mode (SysTick, DWT, etc.)
     TA_State_t state;               // Current analyzer state
+    uint8_t id;                     // Registry id, stable while the analyzer exists, used in trace events
     /* Measurement Data */
-    uint32_t start_time;            // Start time (for SysTick/DWT mode)
-    uint32_t stop_time;             // Stop time (for SysTick/DWT mode)
-    uint32_t elapsed_time;          // duration between the start and stop times
+    uint64_t start_time;            // Start time (SysTick time base, see TA_readSysTick, or 64 bit DWT cycles, see TA_getCycles64)
+    uint64_t stop_time;             // Stop time (SysTick time base, see TA_readSysTick, or 64 bit DWT cycles, see TA_getCycles64)
+    uint64_t elapsed_time;          // duration between the start and stop times, own overhead subtracted
+    uint64_t raw_elapsed_time;      // same as elapsed_time, but including the analyzer's own overhead
+    uint32_t run_time;              // duration of the current run, reset by TA_start, saturates at 0xFFFFFFFF
+    TA_Stats_t stats;               // statistics over all completed runs
+    TA_Hist_t *hist;                // optional distribution of the runs, NULL_PTR when not attached
+    TA_Period_t period;             // start-to-start intervals, see TA_setPeriod
+    TA_Budget_t budget;             // execution budget, see TA_setBudget
+    /* Preemption accounting (DWT modes, runtime API) */
+    uint64_t self_time;             // elapsed_time without the time of analyzers running on top (ISRs, nested regions)
+    uint32_t child_time;            // time of analyzers on top during the open interval
+    uint32_t preempt_count;         // number of intervals of analyzers from another context (ISR) on top of this one
+    uint64_t preempt_time;          // total raw duration of these intervals
+    uint8_t ctx;                    // exception number (IPSR) at the last start/resume, 0 = thread mode
+    uint8_t print_request;          // TRUE while a TA_requestPrint waits for TA_processPrints
     /* Pin Function Link */
     TA_PinFunc_t pin_control_func;  // Unified pin control function
 } TA_t;
 
+#if (TA_CFG_WIRE_FRAME_SIZE > 249U)
+#error "TA_CFG_WIRE_FRAME_SIZE: an encoded frame must fit into one TA_LOG_ARRAY call"
+#endif
+
 // Wrapper to allow representing the file in Together as class
 #ifdef TOGETHER
 
@@ -141,18 +253,78 @@ public:
 /*****************************************************************************/
 /* Extern global variables                                                   */
 /*****************************************************************************/
+extern volatile uint32_t ta_g_system_ms;    // SysTick millisecond counter, read inline by TimingAnalyzer_fast.h, counts only while SysTick runs (TA_CFG_TICKLESS)
+extern volatile boolean_t ta_g_systick_reload;  // SysTick reloaded but ta_g_system_ms not counted yet, see TA_readSysTick
+extern uint32_t ta_g_fast_overhead;         // Calibrated cost of the inline DWT start/stop of TimingAnalyzer_fast.h
+extern uint32_t ta_g_cycles_state;          // Wrap epoch of DWT->CYCCNT (bits 31..1) and its last seen MSB (bit 0), see TA_readCycles64
+extern volatile uint32_t ta_g_enable_mask;  // Enabled instrumentation categories (TA_CAT_*), tested by TA_IF_ENABLED
 
 /*****************************************************************************/
 /* API functions                                                             */
 /*****************************************************************************/
 
 /**
- * Func to initialize of the necessary peripherals like Set up SysTick timer (1 ms), enable DWT counter, and configure GPIO pins.
+ * Func to initialize of the necessary peripherals like Set up SysTick timer (1 ms, with TA_CFG_TICKLESS not before the first SysTick analyzer), enable DWT counter, and configure GPIO pins.
  * \param None
  * \return RC_SUCCESS when success and RC_ERROR_INVALID_STATE when Hardware not properly initilized
 */
 RC_t TA_init(void);
 
+/**
+ * Func to measure the analyzer's own cost of an empty start/stop pair for every mode and for the
+ * inline DWT path of TimingAnalyzer_fast.h. Called by TA_init, the result is subtracted from every measured interval.
+ * \param None
+ * \return RC_SUCCESS when success and RC_ERROR_INVALID_STATE when the DWT counter does not run
+*/
+RC_t TA_calibrate(void);
+
+/**
+ * Func which returns the calibrated self-overhead of a mode, see TA_calibrate.
+ * \param TA_Mode_t const mode          : [IN] measurement mode
+ * \return overhead in counter units (cycles, 0 for SysTick ms and pin only modes)
+*/
+uint32_t TA_getOverhead(TA_Mode_t const mode);
+
+/**
+ * Func to switch instrumentation categories on at runtime. Atomic, callable from any context.
+ * \param uint32_t const categories    : [IN] TA_CAT_* bits
+ * \return None
+*/
+void TA_enableCategories(uint32_t const categories);
+
+/**
+ * Func to switch instrumentation categories off at runtime. Atomic, callable from any context.
+ * A region already started stays open, change the mask between runs.
+ * \param uint32_t const categories    : [IN] TA_CAT_* bits
+ * \return None
+*/
+void TA_disableCategories(uint32_t const categories);
+
+/**
+ * Func which returns the DWT cycle counter extended to 64 bit by its wrap epoch. Monotonic and callable
+ * from any context, as long as it (or any DWT measurement, SysTick_Handler, TALOAD_idle) runs at least
+ * once per half counter period (~89s at 24MHz).
+ * \param None
+ * \return cycles since TA_init
+*/
+uint64_t TA_getCycles64(void);
+
+/**
+ * Func which returns the ms since TA_init, derived on demand from the 64 bit DWT counter (no SysTick needed).
+ * \param None
+ * \return milliseconds since TA_init
+*/
+uint32_t TA_getSystemMs(void);
+
+/**
+ * Func to format a 64 bit counter value as decimal, printf of newlib-nano has no %llu.
+ * \param char *const buffer           : [OUT] text, at least TA_U64_DIGITS bytes for every value
+ * \param uint8_t const size           : [IN] size of the buffer
+ * \param uint64_t value               : [IN] value
+ * \return buffer, an empty string when the value does not fit
+*/
+char *TA_formatU64(char *const buffer, uint8_t const size, uint64_t value);
+
 /**
  * Func to initializes an analyzer struct with configuration and assign function pointers for pin control.
  * \param TA_t *const me                : [IN/OUT] struct of Analyzer related parameters
@@ -160,11 +332,31 @@ RC_t TA_init(void);
  * \param TA_PinFunc_t const pin_ctrl   : [IN] func pointer to control a GPIO pin
  * \param const char const *name        : [IN] name of the Analyzer
  * \return RC_SUCCESS when success, RC_ERROR_NULL when a pointer param is null
- *         RC_ERROR_BAD_PARAM when unexpected params are passed and 
+ *         RC_ERROR_BAD_PARAM when unexpected params are passed, RC_ERROR_BUSY when the analyzer is already created and 
  *         RC_ERROR_BUFFER_FULL when max analyzer count is reached
 */
 RC_t TA_create(TA_t *const me, TA_Mode_t const mode, TA_PinFunc_t const pin_ctrl, const char *name);
 
+#if (TA_CFG_ANALYZER_POOL == ON)
+/**
+ * Func to create an analyzer in the static pool and hand out its handle, which is also its id.
+ * The analyzer is reached with TA_getAnalyzer(handle), no TA_t object is needed in the application.
+ * \param TA_Handle_t *const handle     : [OUT] handle of the new analyzer, TA_ID_NONE on error
+ * \param TA_Mode_t const mode          : [IN] type of the configuration mode we need to run the analyzer
+ * \param TA_PinFunc_t const pin_ctrl   : [IN] func pointer to control a GPIO pin
+ * \param const char const *name        : [IN] name of the Analyzer
+ * \return same as TA_create
+*/
+RC_t TA_createHandle(TA_Handle_t *const handle, TA_Mode_t const mode, TA_PinFunc_t const pin_ctrl, const char *name);
+
+/**
+ * Func to delete an analyzer created by TA_createHandle, the handle becomes free for the next create.
+ * \param TA_Handle_t const handle      : [IN] handle
+ * \return RC_SUCCESS when success and RC_ERROR_BAD_PARAM when the handle is no pool analyzer
+*/
+RC_t TA_deleteHandle(TA_Handle_t const handle);
+#endif
+
 /**
  * Func to start counting using SysTick or DWT and set pin HIGH if configured.
  * \param TA_t *const me            : [IN/OUT] struct of Analyzer related parameters
@@ -199,7 +391,8 @@ RC_t TA_resume(TA_t *const me);
 RC_t TA_stop(TA_t *const me);
 
 /**
- * Func to delete a previously created analyzer. Removes it from the global list and resets its content.
+ * Func to delete a previously created analyzer. Removes it from the global list and resets its content, O(1).
+ * Its id goes back to the free list and is handed out again by a later create.
  * \param TA_t *const me            : [IN] Analyzer instance to be deleted
  * \return RC_SUCCESS when success,
  *         RC_ERROR_NULL when pointer is NULL,
@@ -207,13 +400,123 @@ RC_t TA_stop(TA_t *const me);
  */
 RC_t TA_delete(TA_t *const me);
 
+/**
+ * Func to send name and statistics of all analyzers as binary frames (TAWire.h), the compact counterpart of TA_printAll.
+ * \param None
+ * \return RC_SUCCESS when success and RC_ERROR_BUFFER_EMTPY when analyzer array is empty
+*/
+RC_t TA_sendAll(void);
+
+/**
+ * Func to close a binary frame and send it over UART. The frame is empty afterwards.
+ * \param TA_WireFrame_t *const frame   : [IN/OUT] frame, payload at most TA_CFG_WIRE_FRAME_SIZE
+ * \return RC_SUCCESS when success (also for an empty frame) and RC_ERROR_NULL when the frame pointer is null
+*/
+RC_t TA_sendFrame(TA_WireFrame_t *const frame);
+
+/**
+ * Func which returns the analyzer with the given id or handle, e.g. to resolve trace events. O(1).
+ * \param uint8_t const id          : [IN] analyzer id
+ * \return analyzer, NULL_PTR when no analyzer with this id exists
+*/
+TA_t *TA_getAnalyzer(uint8_t const id);
+
+/**
+ * Func which returns the innermost running DWT analyzer, e.g. to attribute a sample taken by an ISR.
+ * \param None
+ * \return analyzer on top of the running stack, NULL_PTR when none runs or without TA_CFG_PREEMPTION
+*/
+TA_t *TA_getActive(void);
+
 /**
  * Func to calculate the elapsed ticks/cycles between start and stop time.
+ * The interval is added to raw_elapsed_time as measured and to elapsed_time with the calibrated overhead removed.
  * \param TA_t *const me            : [IN/OUT] struct of Analyzer related parameters
  * \return RC_SUCCESS when success
 */
 RC_t TA_calculateElapsedTime(TA_t *const me);
 
+/**
+ * Func to add a completed run to the analyzer's statistics and check its budget. Called by TA_stop, O(1).
+ * \param TA_t *const me            : [IN/OUT] struct of Analyzer related parameters
+ * \param uint32_t const run        : [IN] duration of the run in counter units
+ * \return None
+*/
+void TA_recordRun(TA_t *const me, uint32_t const run);
+
+/**
+ * Func to clear the run and period statistics, e.g. after a warm-up phase.
+ * \param TA_t *const me            : [IN/OUT] struct of Analyzer related parameters
+ * \return RC_SUCCESS when success and RC_ERROR_NULL when the me pointer is null
+*/
+RC_t TA_resetStats(TA_t *const me);
+
+/**
+ * Func which returns the mean run duration.
+ * \param TA_t const *const me      : [IN] struct of Analyzer related parameters
+ * \return mean in counter units, rounded, 0 without runs
+*/
+uint32_t TA_getMean(TA_t const *const me);
+
+/**
+ * Func which returns the sample variance of the run durations.
+ * \param TA_t const *const me      : [IN] struct of Analyzer related parameters
+ * \return variance in counter units^2, 0 with less than 2 runs
+*/
+uint64_t TA_getVariance(TA_t const *const me);
+
+/**
+ * Func which returns the standard deviation (jitter) of the run durations.
+ * \param TA_t const *const me      : [IN] struct of Analyzer related parameters
+ * \return standard deviation in counter units, 0 with less than 2 runs
+*/
+uint32_t TA_getStdDev(TA_t const *const me);
+
+/**
+ * Func to enable the activation period tracking: every TA_start records the interval to the previous start. Clears the period statistics.
+ * \param TA_t *const me            : [IN/OUT] struct of Analyzer related parameters
+ * \param uint32_t const nominal    : [IN] expected period in counter units (DWT cycles, SysTick ms or bus cycles with TA_CFG_SYSTICK_SUBMS), 0 disables the tracking
+ * \return RC_SUCCESS when success, RC_ERROR_NULL when the me pointer is null and
+ *         RC_ERROR_BAD_PARAM for TA_MODE_PIN (no counter)
+*/
+RC_t TA_setPeriod(TA_t *const me, uint32_t const nominal);
+
+/**
+ * Func to set an execution budget: every completed run longer than the budget counts as overrun,
+ * calls the hook and pulses the trigger pin. Clears the overrun counter.
+ * \param TA_t *const me                    : [IN/OUT] struct of Analyzer related parameters
+ * \param uint32_t const limit              : [IN] budget in counter units (DWT cycles, see TA_BUDGET_US, or SysTick ms without TA_CFG_SYSTICK_SUBMS), 0 removes it
+ * \param TA_OverrunHook_t const hook       : [IN] called on every overrun, NULL_PTR for none
+ * \param TA_PinFunc_t const trigger_pin    : [IN] pin pulsed on every overrun, NULL_PTR for none
+ * \return RC_SUCCESS when success, RC_ERROR_NULL when the me pointer is null and
+ *         RC_ERROR_BAD_PARAM for TA_MODE_PIN (no measured runs)
+*/
+RC_t TA_setBudget(TA_t *const me, uint32_t const limit, TA_OverrunHook_t const hook, TA_PinFunc_t const trigger_pin);
+
+/**
+ * Func which returns the mean start-to-start period, see TA_setPeriod.
+ * \param TA_t const *const me      : [IN] struct of Analyzer related parameters
+ * \return mean period in counter units, 0 before the second start
+*/
+uint32_t TA_getPeriodMean(TA_t const *const me);
+
+/**
+ * Func to attach a histogram to an analyzer, every following run is recorded in it. The histogram is cleared.
+ * \param TA_t *const me            : [IN/OUT] struct of Analyzer related parameters
+ * \param TA_Hist_t *const hist     : [IN] histogram owned by the caller, NULL_PTR to detach
+ * \return RC_SUCCESS when success, RC_ERROR_NULL when the me pointer is null and
+ *         RC_ERROR_BAD_PARAM for TA_MODE_PIN (no measured runs)
+*/
+RC_t TA_attachHistogram(TA_t *const me, TA_Hist_t *const hist);
+
+/**
+ * Func which returns a percentile of the run durations, see TAHIST_getPercentile.
+ * \param TA_t const *const me      : [IN] struct of Analyzer related parameters
+ * \param uint16_t const permyriad  : [IN] percentile in 1/10000, e.g. TAHIST_P99
+ * \return value in counter units, 0 without histogram or runs
+*/
+uint32_t TA_getPercentile(TA_t const *const me, uint16_t const permyriad);
+
 /**
  * Func which returns elapsed time in ms based on SysTick or DWT reading.
  * \param TA_t const *const me      : [IN] struct of Analyzer related parameters
@@ -228,6 +531,22 @@ uint32_t TA_getElapsedTimeInMs(TA_t *const me);
 */
 RC_t TA_printStatus(TA_t *const me);
 
+/**
+ * Func to ask for a TA_printStatus of this analyzer outside the caller's context. Costs one store,
+ * so it can be used in ISRs; the text is formatted later by TA_processPrints.
+ * \param TA_t *const me            : [IN/OUT] struct of Analyzer related parameters
+ * \return RC_SUCCESS when success and RC_ERROR_NULL when the me pointer is null
+*/
+RC_t TA_requestPrint(TA_t *const me);
+
+/**
+ * Func to print all analyzers with a pending TA_requestPrint. Background worker, call it from the
+ * idle loop (or it runs in PendSV with TA_CFG_PRINT_PENDSV ON).
+ * \param None
+ * \return RC_SUCCESS when at least one analyzer was printed and RC_ERROR_BUFFER_EMTPY when nothing was pending
+*/
+RC_t TA_processPrints(void);
+
 /**
  * Func to print all the available Analysers
  * \param None
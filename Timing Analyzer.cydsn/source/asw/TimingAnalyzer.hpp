@@ -0,0 +1,118 @@
+/**
+* \file <TimingAnalyzer.hpp>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief C++ binding of the Timing Analyzer - RAII guard for scope measurement
+*
+* Include this header instead of TimingAnalyzer_fast.h in C++ code. TA_SCOPE and TA_SCOPE_CAT
+* behave as in C: a static TA_MODE_DWT analyzer is created on the first pass, started by the
+* constructor of a TA_ScopeGuard and stopped by its destructor when the block is left in any way.
+* Both members are inline and call the same inline functions as the C cleanup variant, so the
+* code between the two counter reads is the same as for TA_START_DWT/TA_STOP_DWT.
+*
+*   void Filter::run()
+*   {
+*       TA_SCOPE("Filter");
+*       ...
+*   }
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+**/
+
+#ifndef TIMINGANALYZER_HPP
+#define TIMINGANALYZER_HPP
+
+extern "C" {
+#include "TimingAnalyzer_fast.h"
+}
+
+/*****************************************************************************/
+/* Scope guard                                                               */
+/*****************************************************************************/
+
+#if (TA_CFG_ENABLE == ON)
+
+/**
+ * Guard of one TA_SCOPE block. Not copyable, the analyzer must be stopped exactly once.
+*/
+class TA_ScopeGuard
+{
+public:
+    /**
+     * Func to enter the scope, see TA_scopeEnter.
+     * \param TA_t &analyzer            : [IN/OUT] static analyzer of the scope
+     * \param const char *const name    : [IN] name of the scope
+    */
+    TA_ScopeGuard(TA_t &analyzer, const char *const name) : m_analyzer(TA_scopeEnter(&analyzer, name))
+    {
+    }
+
+    /**
+     * Func to leave the scope, see TA_scopeExit.
+    */
+    ~TA_ScopeGuard()
+    {
+        TA_scopeExit(&m_analyzer);
+    }
+
+private:
+    TA_ScopeGuard(const TA_ScopeGuard &);
+    TA_ScopeGuard &operator=(const TA_ScopeGuard &);
+
+    TA_t *const m_analyzer;
+};
+
+/**
+ * Guard of one TA_SCOPE_CAT block, holds NULL_PTR when the category was disabled on entry.
+*/
+class TA_ScopeGuardIf
+{
+public:
+    /**
+     * Func to enter the scope if one of the categories is enabled, see TA_ENABLED.
+     * \param uint32_t const cat        : [IN] TA_CAT_* bits
+     * \param TA_t &analyzer            : [IN/OUT] static analyzer of the scope
+     * \param const char *const name    : [IN] name of the scope
+    */
+    TA_ScopeGuardIf(uint32_t const cat, TA_t &analyzer, const char *const name)
+        : m_analyzer(TA_ENABLED(cat) ? TA_scopeEnter(&analyzer, name) : static_cast<TA_t *>(NULL_PTR))
+    {
+    }
+
+    /**
+     * Func to leave the scope, see TA_scopeExitIf.
+    */
+    ~TA_ScopeGuardIf()
+    {
+        TA_scopeExitIf(&m_analyzer);
+    }
+
+private:
+    TA_ScopeGuardIf(const TA_ScopeGuardIf &);
+    TA_ScopeGuardIf &operator=(const TA_ScopeGuardIf &);
+
+    TA_t *const m_analyzer;
+};
+
+#define TA_SCOPE(name)                                                                  \
+    static TA_t TA__SCOPE_ID(ta_scope_);                                                \
+    TA_ScopeGuard const TA__SCOPE_ID(ta_scope_guard_)(TA__SCOPE_ID(ta_scope_), (name))
+#define TA_SCOPE_CAT(cat, name)                                                         \
+    static TA_t TA__SCOPE_ID(ta_scope_);                                                \
+    TA_ScopeGuardIf const TA__SCOPE_ID(ta_scope_guard_)((cat), TA__SCOPE_ID(ta_scope_), (name))
+
+#endif /* TA_CFG_ENABLE */
+
+#endif /* TIMINGANALYZER_HPP */
+
+/* [TimingAnalyzer.hpp] END OF FILE */
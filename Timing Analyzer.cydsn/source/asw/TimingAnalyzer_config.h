@@ -0,0 +1,190 @@
+/**
+* \file <TimingAnalyzer_config.h>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Build time configuration of the Timing Analyzer
+*
+* All configurable parts of TimingAnalyzer.c are collected here. Switches use ON/OFF from global.h.
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+**/
+
+#ifndef TIMINGANALYZER_CONFIG_H
+#define TIMINGANALYZER_CONFIG_H
+
+#include "global.h"
+
+/*****************************************************************************/
+/* Instrumentation switch                                                    */
+/*****************************************************************************/
+
+/** \brief Instrumentation macros (TA_IF_ENABLED, TA_START_DWT, ...) generate code (ON) or compile to nothing (OFF). The runtime API stays available */
+#define TA_CFG_ENABLE                   ON
+
+/** \brief Categories (TA_CAT_ISR, ...) enabled after reset, see TA_enableCategories */
+#define TA_CFG_ENABLE_MASK              (0xFFFFFFFFUL)
+
+/*****************************************************************************/
+/* Registry                                                                  */
+/*****************************************************************************/
+
+/** \brief Number of analyzers which can exist at the same time, ids/handles are 0 .. TA_CFG_MAX_ANALYZERS-1 (at most 255) */
+#define TA_CFG_MAX_ANALYZERS            (10U)
+
+/** \brief Static pool of TA_CFG_MAX_ANALYZERS analyzers for TA_createHandle, so the application needs no TA_t objects of its own (ON/OFF) */
+#define TA_CFG_ANALYZER_POOL            ON
+
+/*****************************************************************************/
+/* Self-overhead calibration                                                 */
+/*****************************************************************************/
+
+/** \brief Measure the cost of an empty start/stop pair in TA_init and subtract it from every interval (ON/OFF) */
+#define TA_CFG_CALIBRATION              ON
+
+/** \brief Number of empty start/stop pairs per mode, the smallest result is used (interrupts can only make it larger) */
+#define TA_CFG_CALIBRATION_RUNS         (16UL)
+
+/*****************************************************************************/
+/* SysTick resolution                                                        */
+/*****************************************************************************/
+
+/** \brief Run the 1 ms SysTick only while a SysTick analyzer exists (ON) or always from TA_init (OFF). Wall time comes from TA_getSystemMs */
+#define TA_CFG_TICKLESS                 ON
+
+/** \brief SysTick modes combine the ms counter with SysTick->VAL and count bus clock cycles (ON) instead of whole ms (OFF) */
+#define TA_CFG_SYSTICK_SUBMS            ON
+
+/*****************************************************************************/
+/* Preemption accounting                                                     */
+/*****************************************************************************/
+
+/** \brief Keep a stack of the running DWT analyzers and charge the time of an analyzer started on top (ISR or nested region) to it instead of to the one below (ON/OFF) */
+#define TA_CFG_PREEMPTION               ON
+
+/** \brief Maximum number of DWT analyzers running on top of each other (nesting over all interrupt levels) */
+#define TA_CFG_PREEMPTION_DEPTH         (8U)
+
+/*****************************************************************************/
+/* ID bus                                                                    */
+/*****************************************************************************/
+
+/** \brief Write id + 1 of the innermost running DWT analyzer (0 = none) to an 8 bit register on every change of the running stack (ON/OFF). Needs TA_CFG_PREEMPTION */
+#define TA_CFG_ID_BUS                   OFF
+
+/** \brief Address of that register, e.g. the data register of a port with 8 output pins (<Pins>__DR) or a Control Register (<Control_Reg>_Sync_ctrl_reg__CONTROL_REG) */
+#define TA_CFG_ID_BUS_REG               (CYREG_PRT3_DR)
+
+/*****************************************************************************/
+/* Run statistics                                                            */
+/*****************************************************************************/
+
+/** \brief Fractional bits of the fixed point running mean. Squared deviations are exact while a run deviates less than 2^(31-bits) counts from the mean */
+#define TA_CFG_STATS_FRAC_BITS          (4U)
+
+/*****************************************************************************/
+/* Trace                                                                     */
+/*****************************************************************************/
+
+/** \brief Record start/pause/resume/stop events in the trace ring of TATrace.c (ON/OFF) */
+#define TA_CFG_TRACE                    ON
+
+/** \brief Pin modes also record a PIN_HI/PIN_LO event right after every pin write of the runtime API, the cycle timestamps of the edges for ta_correlate (ON/OFF). Needs TA_CFG_TRACE */
+#define TA_CFG_PIN_EDGES                ON
+
+/** \brief Number of events in the trace ring (8 byte each), power of two */
+#define TA_CFG_TRACE_SIZE               (256UL)
+
+/** \brief Payload bytes of one binary frame (TAWire.c), the encoded frame must fit into one TA_LOG_ARRAY call (max 249) */
+#define TA_CFG_WIRE_FRAME_SIZE          (128U)
+
+/*****************************************************************************/
+/* Function profiler                                                         */
+/*****************************************************************************/
+
+/** \brief Implement the -finstrument-functions hooks in TAProf.c (ON/OFF). ON needs the compiler flags listed in TAProf.h */
+#define TA_CFG_PROFILER                 OFF
+
+/** \brief Functions in the flat profile (24 byte each), power of two */
+#define TA_CFG_PROF_FUNCS               (64U)
+
+/** \brief Caller -> callee edges (24 byte each), power of two */
+#define TA_CFG_PROF_EDGES               (128U)
+
+/** \brief Deepest profiled call nesting over all interrupt levels, deeper calls are not timed */
+#define TA_CFG_PROF_DEPTH               (32U)
+
+/*****************************************************************************/
+/* Sampling profiler                                                         */
+/*****************************************************************************/
+
+/** \brief Drive TASample.c from a timer interrupt (ON/OFF). ON needs the timer and an isr component with the names below in TopDesign */
+#define TA_CFG_SAMPLER                  OFF
+
+/** \brief Instance name of the timer component (UDB timer, interrupt on terminal count) */
+#define TA_CFG_SAMPLE_TIMER             Timer_1ms_1
+
+/** \brief Instance name of the isr component connected to the interrupt output of the timer */
+#define TA_CFG_SAMPLE_ISR               isr_sample
+
+/** \brief Clock of the timer component in Hz */
+#define TA_CFG_SAMPLE_CLOCK_HZ          (BCLK__BUS_CLK__HZ)
+
+/** \brief Samples per second, a prime number does not lock onto periodic tasks (e.g. the 1 ms ISR) */
+#define TA_CFG_SAMPLE_HZ                (997UL)
+
+/** \brief Priority of the sampling interrupt, 0 = highest so that other ISRs are sampled as well */
+#define TA_CFG_SAMPLE_PRIORITY          (0U)
+
+/** \brief Distinct PC values and LR values in the histograms (8 byte each), power of two */
+#define TA_CFG_SAMPLE_SLOTS             (256U)
+
+/** \brief Entries probed per sample before it is counted as lost, bounds the time spent in the ISR */
+#define TA_CFG_SAMPLE_PROBES            (8U)
+
+/*****************************************************************************/
+/* Log output                                                                */
+/*****************************************************************************/
+
+/** \brief Queue all text and binary output in the ring of LogDma.c instead of waiting on UART_LOG (ON/OFF), the application calls LogDma_Init */
+#define TA_CFG_LOG_DMA                  ON
+
+/*****************************************************************************/
+/* Deferred printing                                                         */
+/*****************************************************************************/
+
+/** \brief TA_requestPrint also pends PendSV, which runs TA_processPrints at the lowest priority (ON/OFF). OFF: call TA_processPrints from the idle loop. Keep OFF when an OS owns PendSV */
+#define TA_CFG_PRINT_PENDSV             OFF
+
+/*****************************************************************************/
+/* CPU load                                                                  */
+/*****************************************************************************/
+
+/** \brief Lengths of the CPU load windows of TALoad.c in ms (at most 178000 at 24 MHz) */
+#define TA_CFG_LOAD_WINDOWS_MS          { 10UL, 100UL, 1000UL }
+
+/** \brief Number of entries in TA_CFG_LOAD_WINDOWS_MS */
+#define TA_CFG_LOAD_WINDOW_COUNT        (3U)
+
+/** \brief Longest idle loop iteration in DWT cycles, a longer gap between two TALOAD_idle calls counts as busy */
+#define TA_CFG_LOAD_IDLE_GAP            (480UL)
+
+/*****************************************************************************/
+/* Histogram                                                                 */
+/*****************************************************************************/
+
+/** \brief Linear sub-buckets per power of two as bits: relative error 2^-bits, (33-bits)*2^bits buckets of 4 byte (3 -> 240 buckets, 12.5%) */
+#define TA_CFG_HIST_SUB_BITS            (3U)
+
+#endif /* TIMINGANALYZER_CONFIG_H */
+
+/* [TimingAnalyzer_config.h] END OF FILE */
@@ -0,0 +1,339 @@
+/**
+* \file <TimingAnalyzer_fast.h>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Compile time specialized start/pause/resume/stop of the Timing Analyzer
+*
+* The runtime API (TA_start, ...) decides on every call which counter and which pin to use.
+* The variants in this file have the mode fixed at compile time: reading the counter and
+* writing the pin are inlined into the caller, there is no mode branching, no NULL check and
+* no state check. The pin is written through the function/macro given at the call site, e.g.
+* GREEN_LED_Write, instead of the pin_control_func pointer. PIN_3_BB_WRITE of Pins.h is a single
+* bit-band store, the shortest pin edge.
+*
+*   TA_START_DWT(&analyzer);                ...   TA_STOP_DWT(&analyzer);
+*   TA_START_DWT_PIN(&analyzer, Pin_3_Control); ... TA_STOP_DWT_PIN(&analyzer, Pin_3_Control);
+*
+* The analyzer still has to be created with TA_create (same mode), so it is listed by TA_printAll
+* and can be mixed with the runtime API. The caller is responsible for the call order.
+* Of the trace events (TATrace.h) only the pin edges of TA_CFG_PIN_EDGES are recorded, right after
+* each PIN_WRITE like in the runtime API. The analyzer takes no part in the preemption accounting
+* (self_time, preempt_count), which needs the running stack of TimingAnalyzer.c.
+*
+* With TA_CFG_ENABLE OFF all macros below are empty. Combined with the category guard of
+* TimingAnalyzer.h a disabled region costs one bit test:
+*
+*   TA_IF_ENABLED(TA_CAT_ISR, TA_START_DWT(&analyzer));
+*
+* Scope measurement: TA_SCOPE creates a static TA_MODE_DWT analyzer on the first pass and starts it;
+* it is stopped whenever the enclosing block is left, also by return, break or goto. In C this is
+* done with __attribute__((cleanup)), C++ code includes TimingAnalyzer.hpp instead (RAII guard).
+*
+*   void Filter_run(void)
+*   {
+*       TA_SCOPE("Filter");                 // or TA_SCOPE_CAT(TA_CAT_MATH, "Filter")
+*       ...
+*   }
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+**/
+
+#ifndef TIMINGANALYZER_FAST_H
+#define TIMINGANALYZER_FAST_H
+
+#include "project.h"
+#include "TimingAnalyzer.h"
+#include "TATrace.h"
+
+/*****************************************************************************/
+/* Inline counter access                                                     */
+/*****************************************************************************/
+
+/**
+ * Func which reads DWT->CYCCNT extended by its wrap epoch. The shared state only changes when the MSB
+ * of the counter has flipped since the last read (twice per counter period); that update is a
+ * compare-and-swap, so a reader interrupted by another reader never counts a wrap twice.  (N18)
+ * \param None
+ * \return 64 bit cycle count
+*/
+STATIC_INLINE uint64_t TA_readCycles64(void)
+{
+    uint32_t state = __atomic_load_n(&ta_g_cycles_state, __ATOMIC_ACQUIRE);
+    uint32_t now;
+    uint32_t epoch;
+    uint32_t next;
+
+    do
+    {
+        now   = DWT->CYCCNT;
+        epoch = state >> 1;
+        if (((state & 1UL) != 0UL) && ((now >> 31) == 0UL))
+        {
+            epoch++;                                // MSB fell from 1 to 0 - the counter wrapped
+        }
+        next = (epoch << 1) | (now >> 31);
+    } while ((next != state) &&
+             (__atomic_compare_exchange_n(&ta_g_cycles_state, &state, next, FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) == FALSE));
+
+    return ((uint64_t)epoch << 32) | now;
+}
+
+/**
+ * Func which adds a run interval to the run duration, which is kept in 32 bit for the statistics.
+ * \param TA_t *const me            : [IN/OUT] analyzer
+ * \param uint64_t const interval   : [IN] interval in counter units
+ * \return None
+*/
+STATIC_INLINE void TA_addRunTime(TA_t *const me, uint64_t const interval)
+{
+    uint64_t run = (uint64_t)me->run_time + interval;
+
+    me->run_time = (run > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32_t)run;
+}
+
+/**
+ * Func to open an interval on the DWT cycle counter.
+ * \param TA_t *const me            : [IN/OUT] analyzer created in TA_MODE_DWT or TA_MODE_DWT_PIN
+ * \return None
+*/
+STATIC_INLINE void TA_openDwt(TA_t *const me)
+{
+    me->start_time = TA_readCycles64();
+    me->state      = TA_STATE_RUNNING;
+}
+
+/**
+ * Func to close an interval on the DWT cycle counter. The 64 bit timestamps cover any number of counter wraps.
+ * \param TA_t *const me            : [IN/OUT] analyzer created in TA_MODE_DWT or TA_MODE_DWT_PIN
+ * \param TA_State_t const state    : [IN] TA_STATE_PAUSED or TA_STATE_STOPPED
+ * \return None
+*/
+STATIC_INLINE void TA_closeDwt(TA_t *const me, TA_State_t const state)
+{
+    uint64_t stop     = TA_readCycles64();
+    uint64_t interval = stop - me->start_time;
+
+    me->stop_time         = stop;
+    me->raw_elapsed_time += interval;
+    interval              = (interval > ta_g_fast_overhead) ? (interval - ta_g_fast_overhead) : 0ULL;
+    me->elapsed_time     += interval;
+    TA_addRunTime(me, interval);
+    me->state             = state;
+}
+
+/**
+ * Func which reads the SysTick time base. With TA_CFG_SYSTICK_SUBMS the ms counter and the current value
+ * of the SysTick down counter are combined in one critical section; a reload which SysTick_Handler has
+ * not counted yet shows up in the COUNTFLAG (latched in ta_g_systick_reload) and is added here.  (N19)
+ * \param None
+ * \return bus clock cycles since TA_init (TA_CFG_SYSTICK_SUBMS), otherwise ms
+*/
+STATIC_INLINE uint64_t TA_readSysTick(void)
+{
+#if (TA_CFG_SYSTICK_SUBMS == ON)
+    uint8 intr = CyEnterCriticalSection();
+    uint32_t load = SysTick->LOAD;
+    uint32_t ms   = ta_g_system_ms;
+    uint32_t val  = SysTick->VAL;
+
+    // Reading clears the flag, the latch keeps the reload for the next readers until the handler counts it
+    if (CySysTickGetCountFlag() != 0UL)
+    {
+        ta_g_systick_reload = TRUE;
+    }
+    if (ta_g_systick_reload != FALSE)
+    {
+        val = SysTick->VAL;                         // Surely after the reload, the one read before may be from before
+        ms++;                                       // The handler has not counted this ms yet
+    }
+    CyExitCriticalSection(intr);
+
+    return ((uint64_t)ms * (load + 1UL)) + (load - val);
+#else
+    return ta_g_system_ms;
+#endif
+}
+
+/**
+ * Func to open an interval on the SysTick counter.
+ * \param TA_t *const me            : [IN/OUT] analyzer created in TA_MODE_SYSTICK or TA_MODE_SYSTICK_PIN
+ * \return None
+*/
+STATIC_INLINE void TA_openSysTick(TA_t *const me)
+{
+    me->start_time = TA_readSysTick();
+    me->state      = TA_STATE_RUNNING;
+}
+
+/**
+ * Func to close an interval on the SysTick counter.
+ * \param TA_t *const me            : [IN/OUT] analyzer created in TA_MODE_SYSTICK or TA_MODE_SYSTICK_PIN
+ * \param TA_State_t const state    : [IN] TA_STATE_PAUSED or TA_STATE_STOPPED
+ * \return None
+*/
+STATIC_INLINE void TA_closeSysTick(TA_t *const me, TA_State_t const state)
+{
+    uint64_t stop     = TA_readSysTick();
+    uint64_t interval = stop - me->start_time;
+
+    me->stop_time         = stop;
+    me->raw_elapsed_time += interval;
+    me->elapsed_time     += interval;
+    TA_addRunTime(me, interval);
+    me->state             = state;
+}
+
+/**
+ * Func to begin a new run, START differs from RESUME only by clearing the run duration.
+ * \param TA_t *const me            : [IN/OUT] analyzer created in any counter mode
+ * \return None
+*/
+STATIC_INLINE void TA_beginRun(TA_t *const me)
+{
+    me->run_time = 0UL;
+}
+
+/**
+ * Func to enter a TA_SCOPE block. Creates the static analyzer on the first pass, afterwards it is the
+ * same as TA_START_DWT. A failed create is not retried, the scope is then measured but not listed. (N23)
+ * \param TA_t *const me            : [IN/OUT] static analyzer of the scope
+ * \param const char *const name    : [IN] name of the scope
+ * \return me, to be stopped with TA_scopeExit
+*/
+STATIC_INLINE TA_t *TA_scopeEnter(TA_t *const me, const char *const name)
+{
+    // Zero initialized, name is set by TA_create - only taken on the first pass
+    if (me->name == NULL_PTR)
+    {
+        if (TA_create(me, TA_MODE_DWT, (TA_PinFunc_t)NULL_PTR, name) != RC_SUCCESS)
+        {
+            me->name = name;
+        }
+    }
+    TA_beginRun(me);
+    TA_openDwt(me);
+
+    return me;
+}
+
+/**
+ * Func which stops the analyzer of a TA_SCOPE block, the same as TA_STOP_DWT. Cleanup function of the guard.
+ * \param TA_t *const *const guard  : [IN] guard holding the analyzer
+ * \return None
+*/
+STATIC_INLINE void TA_scopeExit(TA_t *const *const guard)
+{
+    TA_closeDwt(*guard, TA_STATE_STOPPED);
+    TA_recordRun(*guard, (*guard)->run_time);
+}
+
+/**
+ * Func which stops the analyzer of a TA_SCOPE_CAT block if its category was enabled on entry.
+ * \param TA_t *const *const guard  : [IN] guard holding the analyzer, NULL_PTR when disabled
+ * \return None
+*/
+STATIC_INLINE void TA_scopeExitIf(TA_t *const *const guard)
+{
+    if (*guard != NULL_PTR)
+    {
+        TA_scopeExit(guard);
+    }
+}
+
+/*****************************************************************************/
+/* Specialized API - one macro per mode and operation                        */
+/*****************************************************************************/
+
+#if (TA_CFG_ENABLE == ON)
+
+/* Pin write followed by its edge timestamp (TA_CFG_PIN_EDGES), empty record otherwise */
+#define TA__PIN_HIGH(me, PIN_WRITE)         do { PIN_WRITE(1U); TATRACE_RECORD_EDGE((me)->id, TATRACE_EVT_PIN_HIGH); } while (0)
+#define TA__PIN_LOW(me, PIN_WRITE)          do { PIN_WRITE(0U); TATRACE_RECORD_EDGE((me)->id, TATRACE_EVT_PIN_LOW); } while (0)
+
+/* TA_MODE_DWT */
+#define TA_START_DWT(me)                    do { TA_beginRun(me); TA_openDwt(me); } while (0)
+#define TA_PAUSE_DWT(me)                    TA_closeDwt((me), TA_STATE_PAUSED)
+#define TA_RESUME_DWT(me)                   TA_openDwt(me)
+#define TA_STOP_DWT(me)                     do { TA_closeDwt((me), TA_STATE_STOPPED); TA_recordRun((me), (me)->run_time); } while (0)
+
+/* TA_MODE_DWT_PIN - pin before the counter on open, after it on close, like the runtime API */
+#define TA_START_DWT_PIN(me, PIN_WRITE)     do { TA_beginRun(me); TA__PIN_HIGH((me), PIN_WRITE); TA_openDwt(me); } while (0)
+#define TA_PAUSE_DWT_PIN(me, PIN_WRITE)     do { TA_closeDwt((me), TA_STATE_PAUSED); TA__PIN_LOW((me), PIN_WRITE); } while (0)
+#define TA_RESUME_DWT_PIN(me, PIN_WRITE)    do { TA__PIN_HIGH((me), PIN_WRITE); TA_openDwt(me); } while (0)
+#define TA_STOP_DWT_PIN(me, PIN_WRITE)      do { TA_closeDwt((me), TA_STATE_STOPPED); TA__PIN_LOW((me), PIN_WRITE); TA_recordRun((me), (me)->run_time); } while (0)
+
+/* TA_MODE_SYSTICK */
+#define TA_START_SYSTICK(me)                do { TA_beginRun(me); TA_openSysTick(me); } while (0)
+#define TA_PAUSE_SYSTICK(me)                TA_closeSysTick((me), TA_STATE_PAUSED)
+#define TA_RESUME_SYSTICK(me)               TA_openSysTick(me)
+#define TA_STOP_SYSTICK(me)                 do { TA_closeSysTick((me), TA_STATE_STOPPED); TA_recordRun((me), (me)->run_time); } while (0)
+
+/* TA_MODE_SYSTICK_PIN */
+#define TA_START_SYSTICK_PIN(me, PIN_WRITE) do { TA_beginRun(me); TA__PIN_HIGH((me), PIN_WRITE); TA_openSysTick(me); } while (0)
+#define TA_PAUSE_SYSTICK_PIN(me, PIN_WRITE) do { TA_closeSysTick((me), TA_STATE_PAUSED); TA__PIN_LOW((me), PIN_WRITE); } while (0)
+#define TA_RESUME_SYSTICK_PIN(me, PIN_WRITE) do { TA__PIN_HIGH((me), PIN_WRITE); TA_openSysTick(me); } while (0)
+#define TA_STOP_SYSTICK_PIN(me, PIN_WRITE)  do { TA_closeSysTick((me), TA_STATE_STOPPED); TA__PIN_LOW((me), PIN_WRITE); TA_recordRun((me), (me)->run_time); } while (0)
+
+/* TA_MODE_PIN */
+#define TA_START_PIN(me, PIN_WRITE)         do { TA__PIN_HIGH((me), PIN_WRITE); (me)->state = TA_STATE_RUNNING; } while (0)
+#define TA_PAUSE_PIN(me, PIN_WRITE)         do { TA__PIN_LOW((me), PIN_WRITE); (me)->state = TA_STATE_PAUSED; } while (0)
+#define TA_RESUME_PIN(me, PIN_WRITE)        do { TA__PIN_HIGH((me), PIN_WRITE); (me)->state = TA_STATE_RUNNING; } while (0)
+#define TA_STOP_PIN(me, PIN_WRITE)          do { TA__PIN_LOW((me), PIN_WRITE); (me)->state = TA_STATE_STOPPED; } while (0)
+
+/* Scope measurement, one per source line - the line number makes the names unique */
+#define TA__CONCAT2(a, b)                   a##b
+#define TA__CONCAT(a, b)                    TA__CONCAT2(a, b)
+#define TA__SCOPE_ID(prefix)                TA__CONCAT(prefix, __LINE__)
+
+#ifndef __cplusplus
+#define TA_SCOPE(name)                                                                          \
+    static TA_t TA__SCOPE_ID(ta_scope_);                                                        \
+    TA_t *const TA__SCOPE_ID(ta_scope_guard_) __attribute__((cleanup(TA_scopeExit))) =          \
+        TA_scopeEnter(&TA__SCOPE_ID(ta_scope_), (name))
+#define TA_SCOPE_CAT(cat, name)                                                                 \
+    static TA_t TA__SCOPE_ID(ta_scope_);                                                        \
+    TA_t *const TA__SCOPE_ID(ta_scope_guard_) __attribute__((cleanup(TA_scopeExitIf))) =        \
+        (TA_ENABLED(cat) ? TA_scopeEnter(&TA__SCOPE_ID(ta_scope_), (name)) : NULL_PTR)
+#endif
+
+#else
+
+/* TA_CFG_ENABLE OFF - instrumentation compiles to nothing (N22) */
+#define TA_START_DWT(me)                     do { (void)(me); } while (0)
+#define TA_PAUSE_DWT(me)                     do { (void)(me); } while (0)
+#define TA_RESUME_DWT(me)                    do { (void)(me); } while (0)
+#define TA_STOP_DWT(me)                      do { (void)(me); } while (0)
+#define TA_START_DWT_PIN(me, PIN_WRITE)      do { (void)(me); } while (0)
+#define TA_PAUSE_DWT_PIN(me, PIN_WRITE)      do { (void)(me); } while (0)
+#define TA_RESUME_DWT_PIN(me, PIN_WRITE)     do { (void)(me); } while (0)
+#define TA_STOP_DWT_PIN(me, PIN_WRITE)       do { (void)(me); } while (0)
+#define TA_START_SYSTICK(me)                 do { (void)(me); } while (0)
+#define TA_PAUSE_SYSTICK(me)                 do { (void)(me); } while (0)
+#define TA_RESUME_SYSTICK(me)                do { (void)(me); } while (0)
+#define TA_STOP_SYSTICK(me)                  do { (void)(me); } while (0)
+#define TA_START_SYSTICK_PIN(me, PIN_WRITE)  do { (void)(me); } while (0)
+#define TA_PAUSE_SYSTICK_PIN(me, PIN_WRITE)  do { (void)(me); } while (0)
+#define TA_RESUME_SYSTICK_PIN(me, PIN_WRITE) do { (void)(me); } while (0)
+#define TA_STOP_SYSTICK_PIN(me, PIN_WRITE)   do { (void)(me); } while (0)
+#define TA_START_PIN(me, PIN_WRITE)          do { (void)(me); } while (0)
+#define TA_PAUSE_PIN(me, PIN_WRITE)          do { (void)(me); } while (0)
+#define TA_RESUME_PIN(me, PIN_WRITE)         do { (void)(me); } while (0)
+#define TA_STOP_PIN(me, PIN_WRITE)           do { (void)(me); } while (0)
+#define TA_SCOPE(name)                       do { } while (0)
+#define TA_SCOPE_CAT(cat, name)              do { } while (0)
+
+#endif /* TA_CFG_ENABLE */
+
+#endif /* TIMINGANALYZER_FAST_H */
+
+/* [TimingAnalyzer_fast.h] END OF FILE */
@@ -17,16 +17,20 @@
 
 // Project specific header files
 #include "TimingAnalyzer.h"
+#include "TATrace.h"
+#include "TALoad.h"
 #include "Pins.h"
+#include "LogDma.h"
 
 volatile TA_t analyzerDwt;     // Creating obj inside main can not be used to refer an isr. !!!
 volatile TA_t analyzerSystick;   // (N3)
 volatile TA_t analyzerPin;
 volatile TA_t analyzerMath;
-volatile TA_t analyzerIsr1msDWT;
 volatile TA_t analyzerIsr1msSYS;
-volatile TA_t analyzerIsr2secsDWT;
 volatile TA_t analyzerIsr2secsSYS;
+TA_Handle_t isr1msDwt = TA_ID_NONE;     // Pool analyzers of the ISRs, no TA_t of our own   (N8)
+TA_Handle_t isr2secsDwt = TA_ID_NONE;
+TA_Hist_t histIsr1ms;            // Distribution of the 1ms ISR runtime
 
 extern volatile uint32_t system_ms;
 
@@ -52,11 +56,12 @@ int main(void)
     
     // Initialize UART protocol
     UART_LOG_Start();
+    res = LogDma_Init();    // Non-blocking output queue in front of UART_LOG (N5)
     
-    UART_LOG_PutString("\r\n\r\nTiming Analyzer\r\n");                                                // (N1)
+    TA_LOG_STRING("\r\n\r\nTiming Analyzer\r\n");                                                    // (N1)
     sprintf(strMessage, "CPU-Frequency: %luMHz\r\n", ((unsigned long)BCLK__BUS_CLK__HZ / 1000000));   // (N2)
-    UART_LOG_PutString(strMessage); 
-    CyDelay(100);       // Wating for UART to complete  
+    TA_LOG_STRING(strMessage); 
+    LogDma_Flush();     // Banner out before the measurements start
     
     #ifdef CodeSnippetIsr
     //res = TA_create((TA_t *)&analyzerIsr1msDWT, TA_MODE_DWT_PIN, Pin_3_Control, "ISR 1ms DWT Test");
@@ -64,8 +69,12 @@ int main(void)
     //res = TA_create((TA_t *)&analyzerIsr2secsDWT, TA_MODE_DWT_PIN, Pin_2_Control, "ISR 2secs DWT Test");
     //res = TA_create((TA_t *)&analyzerIsr2secsSYS, TA_TA_MODE_SYSTICK_PIN, Pin_2_Control, "ISR 2secs SYS Test");
     
-    res = TA_create((TA_t *)&analyzerIsr1msDWT, TA_MODE_DWT_PIN, YELLOW_LED_Write, "ISR 1ms DWT Func Test");
-    res = TA_create((TA_t *)&analyzerIsr2secsDWT, TA_MODE_DWT_PIN, GREEN_LED_Write, "ISR 2secs DWT Func Test");
+    res = TA_createHandle(&isr1msDwt, TA_MODE_DWT_PIN, YELLOW_LED_Write, "ISR 1ms DWT Func Test");
+    res = TA_createHandle(&isr2secsDwt, TA_MODE_DWT_PIN, GREEN_LED_Write, "ISR 2secs DWT Func Test");
+    res = TA_attachHistogram(TA_getAnalyzer(isr1msDwt), &histIsr1ms);
+    res = TA_setPeriod(TA_getAnalyzer(isr1msDwt), BCLK__BUS_CLK__KHZ);        // Timer_1ms: 1ms = BCLK__BUS_CLK__KHZ cycles
+    res = TA_setPeriod(TA_getAnalyzer(isr2secsDwt), 2UL * BCLK__BUS_CLK__HZ);
+    res = TA_setBudget(TA_getAnalyzer(isr1msDwt), TA_BUDGET_US(50), NULL_PTR, RED_LED_Write);   // Scope trigger on RED_LED
     
     Timer_1ms_Start();                      // Start timer hardware
     Timer_2secs_Start();
@@ -146,16 +155,39 @@ int main(void)
     
     //TA_delete((TA_t *)&analyzerSystick);
     
-    UART_LOG_PutString("\r\nPrinting All Analyzers\r\n"); 
+    TA_LOG_STRING("\r\nPrinting All Analyzers\r\n"); 
     res = TA_printAll();
     
+    #if (TA_CFG_TRACE == ON)
+    // Timeline of all start/stop events
+    (void)TATRACE_printAll();
+    #endif
+    
     // Info for debugging
     if(res != RC_SUCCESS)
     {
         char strError[20];
         sprintf(strError, "Error: code %u\r\n", res);
-        UART_LOG_PutString(strError);
+        TA_LOG_STRING(strError);
+    }
+    
+    #ifdef CodeSnippetIsr
+    // Idle loop - background work requested by the ISRs
+    for (;;)
+    {
+        TALOAD_idle();      // CPU load from the gaps between two passes  (N7)
+        
+        if (TA_processPrints() == RC_SUCCESS)
+        {
+            TAHIST_dump(&histIsr1ms, "ISR 1ms");
+            (void)TALOAD_printStatus();
+        }
+        (void)LogDma_Process();
     }
+    #endif
+    
+    // Hand out everything still queued before main returns
+    LogDma_Flush();
 }
 
 
@@ -165,8 +197,9 @@ int main(void)
 */
 CY_ISR(ISR_1ms_handler)
 {
-    // Starting time measurement
-    TA_start((TA_t *)&analyzerIsr1msDWT);
+    // Starting time measurement, skipped with one bit test while TA_CAT_ISR is off      (N9)
+    // TA_getAnalyzer is O(1), NULL_PTR is rejected by the API
+    TA_IF_ENABLED(TA_CAT_ISR, (void)TA_start(TA_getAnalyzer(isr1msDwt)));
     //TA_start((TA_t *)&analyzerIsr1msSYS);
     
     // Clear interrupt flag
@@ -176,7 +209,7 @@ CY_ISR(ISR_1ms_handler)
     // Work - do nothing
     
     // Stoping time measurement
-    TA_stop((TA_t *)&analyzerIsr1msDWT);
+    TA_IF_ENABLED(TA_CAT_ISR, (void)TA_stop(TA_getAnalyzer(isr1msDwt)));
     //TA_stop((TA_t *)&analyzerIsr1msSYS);
 }
 
@@ -185,8 +218,10 @@ CY_ISR(ISR_1ms_handler)
 */
 CY_ISR(ISR_2secs_handler)
 {
+    TA_t *const analyzer = TA_getAnalyzer(isr2secsDwt);
+    
     // Starting time measurement
-    TA_start((TA_t *)&analyzerIsr2secsDWT);
+    TA_start(analyzer);
     //TA_start((TA_t *)&analyzerIsr2secsSYS);
     
     // Clear interrupt flag
@@ -197,11 +232,12 @@ CY_ISR(ISR_2secs_handler)
     CyDelay(1000);
 
     // Stoping time measurement
-    TA_stop((TA_t *)&analyzerIsr2secsDWT);
+    TA_stop(analyzer);
     //TA_stop((TA_t *)&analyzerIsr2secsSYS);
     
-    TA_printStatus((TA_t *)&analyzerIsr2secsDWT);
-    TA_printStatus((TA_t *)&analyzerIsr2secsSYS);
+    // Printed later by the idle loop, the ISR only sets a flag     (N6)
+    TA_requestPrint(analyzer);
+    TA_requestPrint(TA_getAnalyzer(isr1msDwt));
 }
 #endif
 
@@ -222,6 +258,23 @@ CY_ISR(ISR_2secs_handler)
  *                3. Connect the ISR to the Interrupt (in main loop)
  *                4. Clear Interrupt Flag (inside ISR)
  *
+ * 5. All output goes through TA_LOG_STRING, with TA_CFG_LOG_DMA ON it is only copied into the ring
+ * of LogDma.c, so a print call no longer blocks for the whole transmission.
+ * LogDma_Process has to be called regularly to keep the output moving (idle loop, end of main).
+ *
+ * 6. TA_printStatus inside an ISR blocks all lower priority interrupts for the whole formatting.
+ * TA_requestPrint costs one store, TA_processPrints in the idle loop does the printing.
+ *
+ * 7. TALOAD_idle has to be the first call of every pass. A pass which does not find work takes less
+ * than TA_CFG_LOAD_IDLE_GAP cycles and is counted as idle time, everything else as load.
+ *
+ * 8. Handles - TA_createHandle takes the analyzer out of the static pool of TimingAnalyzer.c, the
+ * application only keeps the small id. TA_getAnalyzer(handle) is an array access, cheap enough for
+ * every ISR entry, and the id is the same one the trace and the binary frames carry.
+ *
+ * 9. The 1 ms path can stay instrumented in a production image: TA_disableCategories(TA_CAT_ISR)
+ * reduces it to a bit test, TA_CFG_ENABLE OFF removes it completely.
+ *
  * > MISRA-C:2004 compliancy - ~85–90%
  */
 
@@ -0,0 +1,355 @@
+/**
+* \file <LogDma.c>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Non-blocking UART_LOG output through a RAM ring drained by DMA
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+*/
+
+/*****************************************************************************/
+/* Include files                                                             */
+/*****************************************************************************/
+#include <string.h>
+#include "project.h"
+#include "LogDma.h"
+#include "UART_LOG.h"
+
+/*****************************************************************************/
+/* Local pre-processor symbols/macros ('#define')                            */
+/*****************************************************************************/
+#define LOGDMA_MASK                 (LOGDMA_BUFFER_SIZE - 1U)
+
+/* DMA path only when the design contains the DMA_LOG component (N1) */
+#ifdef DMA_LOG__DRQ_NUMBER
+#define LOGDMA_USE_DMA
+#include "DMA_LOG_dma.h"
+#define LOGDMA_BYTES_PER_BURST      (1U)
+#define LOGDMA_REQUEST_PER_BURST    (1U)
+#define LOGDMA_TD_COUNT             (2U)
+
+/* 16 bit TD address, the upper half is set per channel by DMA_LOG_DmaInitialize (N5) */
+#if (ARCHITECTURE == ARCH_HOST)
+#define LOGDMA_TD_ADDRESS(address)  HOST_dmaAddress(address)
+#else
+#define LOGDMA_TD_ADDRESS(address)  LO16((uint32)(address))
+#endif
+#endif
+
+/*****************************************************************************/
+/* Local variable definitions ('static')                                     */
+/*****************************************************************************/
+static uint8_t logdma_g_ring[LOGDMA_BUFFER_SIZE];
+static uint32_t logdma_g_head = 0UL;        // End of the published bytes, free running        (N2)
+static uint32_t logdma_g_tail = 0UL;        // Next byte to send, free running
+static uint32_t logdma_g_reserved = 0UL;    // End of the reserved bytes, free running        (N3)
+static uint8_t logdma_g_writers = 0U;       // Producers copying into their reservation
+static uint32_t logdma_g_dropped = 0UL;
+
+#ifdef LOGDMA_USE_DMA
+static uint8_t logdma_g_channel = CY_DMA_INVALID_CHANNEL;
+static uint8_t logdma_g_td[LOGDMA_TD_COUNT] = { CY_DMA_INVALID_TD, CY_DMA_INVALID_TD };
+static uint32_t logdma_g_in_flight = 0UL;   // Bytes owned by the running TD chain, released when it has finished
+#endif
+
+/*****************************************************************************/
+/* Local function prototypes ('static')                                      */
+/*****************************************************************************/
+static void LogDma__send(void);
+
+/*****************************************************************************/
+/* Function implementation - global ('extern') and local ('static')          */
+/*****************************************************************************/
+
+/**
+ * Func to initialize the ring and, when present, the DMA_LOG channel and its TDs. Call once after UART_LOG_Start.
+ * \param None
+ * \return RC_SUCCESS when success and RC_ERROR when no DMA channel or TD could be allocated
+*/
+RC_t LogDma_Init(void)
+{
+    logdma_g_head     = 0UL;
+    logdma_g_tail     = 0UL;
+    logdma_g_reserved = 0UL;
+    logdma_g_writers  = 0U;
+    logdma_g_dropped  = 0UL;
+
+#ifdef LOGDMA_USE_DMA
+    logdma_g_in_flight = 0UL;
+
+    // Source in SRAM, destination is the TX FIFO of UART_LOG in the peripheral space
+    logdma_g_channel = DMA_LOG_DmaInitialize(LOGDMA_BYTES_PER_BURST, LOGDMA_REQUEST_PER_BURST,
+                                             HI16(CYDEV_SRAM_BASE), HI16(CYDEV_PERIPH_BASE));
+
+    // TDs are allocated once and kept by a later LogDma_Init, the pool has no free call here
+    for (uint8_t i = 0U; i < LOGDMA_TD_COUNT; i++)
+    {
+        if (logdma_g_td[i] == CY_DMA_INVALID_TD)
+        {
+            logdma_g_td[i] = CyDmaTdAllocate();
+        }
+    }
+
+    if ((logdma_g_channel == CY_DMA_INVALID_CHANNEL) ||
+        (logdma_g_td[0] == CY_DMA_INVALID_TD) || (logdma_g_td[1] == CY_DMA_INVALID_TD))
+    {
+        return RC_ERROR;
+    }
+#endif
+
+    return RC_SUCCESS;
+}
+
+/**
+ * Func to queue a string for output. Never waits, callable from main and ISRs.
+ * \param const char *const string  : [IN] zero terminated string
+ * \return RC_SUCCESS when queued, RC_ERROR_NULL when the string is null and
+ *         RC_ERROR_BUFFER_FULL when the ring has no room (the whole string is dropped)
+*/
+RC_t LogDma_PutString(const char *const string)
+{
+    size_t length;
+
+    if (string == NULL_PTR)
+    {
+        return RC_ERROR_NULL;
+    }
+
+    length = strlen(string);
+    if (length > LOGDMA_BUFFER_SIZE)
+    {
+        logdma_g_dropped += (uint32_t)length;
+        return RC_ERROR_BUFFER_FULL;
+    }
+
+    return LogDma_PutArray((const uint8_t *)string, (uint16_t)length);
+}
+
+/**
+ * Func to queue a block of bytes for output, e.g. a binary frame. Never waits, callable from main and ISRs.
+ * \param const uint8_t *const data : [IN] bytes
+ * \param uint16_t const length     : [IN] number of bytes
+ * \return RC_SUCCESS when queued, RC_ERROR_NULL when the data pointer is null and
+ *         RC_ERROR_BUFFER_FULL when the ring has no room (the whole block is dropped)
+*/
+RC_t LogDma_PutArray(const uint8_t *const data, uint16_t const length)
+{
+    uint32_t start;
+    uint32_t first;
+    uint8 intr;
+
+    if (data == NULL_PTR)
+    {
+        return RC_ERROR_NULL;
+    }
+
+    // Reserve the span, the copy itself runs with interrupts enabled    (N3)
+    intr = CyEnterCriticalSection();
+
+    start = logdma_g_reserved;
+    if ((uint32_t)length > (LOGDMA_BUFFER_SIZE - (start - logdma_g_tail)))
+    {
+        // Never a partial message - a cut binary frame would only cost a CRC error at the receiver
+        logdma_g_dropped += length;
+        CyExitCriticalSection(intr);
+        return RC_ERROR_BUFFER_FULL;
+    }
+    logdma_g_reserved = start + length;
+    logdma_g_writers++;
+
+    CyExitCriticalSection(intr);
+
+    // Copy in up to two pieces around the end of the ring
+    first = LOGDMA_BUFFER_SIZE - (start & LOGDMA_MASK);
+    if (first > length)
+    {
+        first = length;
+    }
+    memcpy(&logdma_g_ring[start & LOGDMA_MASK], data, first);
+    memcpy(&logdma_g_ring[0], &data[first], length - first);
+
+    // Commit - the last producer to finish publishes all reservations, the ones of the ISRs it was interrupted by included
+    intr = CyEnterCriticalSection();
+
+    logdma_g_writers--;
+    if (logdma_g_writers == 0U)
+    {
+        logdma_g_head = logdma_g_reserved;
+    }
+    LogDma__send();
+
+    CyExitCriticalSection(intr);
+
+    return RC_SUCCESS;
+}
+
+/**
+ * Func to queue a string for output, waiting for room when the ring is full. For long reports
+ * (profiles, histograms) which are larger than the ring; main context only, never from an ISR.
+ * \param const char *const string  : [IN] zero terminated string, at most LOGDMA_BUFFER_SIZE characters
+ * \return RC_SUCCESS when queued, RC_ERROR_NULL when the string is null and
+ *         RC_ERROR_BUFFER_FULL when the string is longer than the whole ring
+*/
+RC_t LogDma_PutStringWait(const char *const string)
+{
+    RC_t res = LogDma_PutString(string);
+
+    if (res == RC_ERROR_BUFFER_FULL)
+    {
+        LogDma_Flush();
+        res = LogDma_PutString(string);
+    }
+
+    return res;
+}
+
+/**
+ * Func to move the output forward: retires the finished DMA transfer and starts the next one
+ * (without DMA: fills the free TX FIFO entries). Called by the put functions, call it from the idle loop as well.
+ * \param None
+ * \return RC_SUCCESS when the ring is empty and RC_ERROR_BUSY while output is pending
+*/
+RC_t LogDma_Process(void)
+{
+    RC_t res;
+    uint8 intr = CyEnterCriticalSection();
+
+    LogDma__send();
+    res = (logdma_g_head == logdma_g_tail) ? RC_SUCCESS : RC_ERROR_BUSY;
+
+    CyExitCriticalSection(intr);
+
+    return res;
+}
+
+/**
+ * Func to wait until all queued output has been handed to the UART, e.g. before a reset.
+ * \param None
+ * \return None
+*/
+void LogDma_Flush(void)
+{
+    while (LogDma_Process() == RC_ERROR_BUSY)
+    {
+        // Busy wait on purpose, only used where blocking is acceptable
+    }
+}
+
+/**
+ * Func which returns the number of bytes lost because the ring was full.
+ * \param None
+ * \return number of dropped bytes since LogDma_Init
+*/
+uint32_t LogDma_GetDropped(void)
+{
+    return logdma_g_dropped;
+}
+
+#ifdef LOGDMA_USE_DMA
+/**
+ * Func to hand the pending part of the ring to the DMA channel. Caller holds the critical section.
+ * When the previous TD chain has finished, its bytes are released and all bytes queued so far are
+ * sent with one chain of at most two TDs (the second one covers the wrap of the ring).     (N4)
+ * \param None
+ * \return None
+*/
+static void LogDma__send(void)
+{
+    uint8 state;
+    uint32_t tail;
+    uint32_t pending;
+    uint32_t first;
+
+    if (logdma_g_in_flight != 0UL)
+    {
+        (void)CyDmaChStatus(logdma_g_channel, NULL, &state);
+        if ((state & CY_DMA_STATUS_CHAIN_ACTIVE) != 0U)
+        {
+            return;                                 // Still sending
+        }
+        logdma_g_tail += logdma_g_in_flight;
+        logdma_g_in_flight = 0UL;
+    }
+
+    tail = logdma_g_tail;
+    pending = logdma_g_head - tail;
+    if (pending == 0UL)
+    {
+        return;
+    }
+
+    first = LOGDMA_BUFFER_SIZE - (tail & LOGDMA_MASK);
+    if (first > pending)
+    {
+        first = pending;
+    }
+
+    (void)CyDmaTdSetConfiguration(logdma_g_td[0], (uint16)first,
+                                  (pending > first) ? logdma_g_td[1] : CY_DMA_DISABLE_TD, CY_DMA_TD_INC_SRC_ADR);
+    (void)CyDmaTdSetAddress(logdma_g_td[0], LOGDMA_TD_ADDRESS(&logdma_g_ring[tail & LOGDMA_MASK]), LOGDMA_TD_ADDRESS(UART_LOG_TXDATA_PTR));
+    if (pending > first)
+    {
+        (void)CyDmaTdSetConfiguration(logdma_g_td[1], (uint16)(pending - first), CY_DMA_DISABLE_TD, CY_DMA_TD_INC_SRC_ADR);
+        (void)CyDmaTdSetAddress(logdma_g_td[1], LOGDMA_TD_ADDRESS(&logdma_g_ring[0]), LOGDMA_TD_ADDRESS(UART_LOG_TXDATA_PTR));
+    }
+
+    (void)CyDmaChSetInitialTd(logdma_g_channel, logdma_g_td[0]);
+    logdma_g_in_flight = pending;
+    (void)CyDmaChEnable(logdma_g_channel, 1U);
+}
+#else
+/**
+ * Func to move bytes of the ring into the free entries of the TX FIFO. Caller holds the critical section.
+ * Software stand-in for the DMA channel, it never waits for the UART.
+ * \param None
+ * \return None
+*/
+static void LogDma__send(void)
+{
+    while ((logdma_g_tail != logdma_g_head) && ((UART_LOG_ReadTxStatus() & UART_LOG_TX_STS_FIFO_NOT_FULL) != 0U))
+    {
+        UART_LOG_WriteTxData(logdma_g_ring[logdma_g_tail & LOGDMA_MASK]);
+        logdma_g_tail++;
+    }
+}
+#endif
+
+/* NOTE
+ *
+ * 1. DMA_LOG is not part of the design yet (no DMA_LOG__DRQ_NUMBER in cyfitter.h). Until it is added
+ * in TopDesign, LogDma__send falls back to filling the 4 byte TX FIFO whenever it is called, so the
+ * put functions still return immediately and the rest of the ring follows with the next calls.
+ *
+ * 2. head and tail are free running, head - tail is the fill level (unsigned arithmetic covers the
+ * wrap). The DMA reads directly out of the ring, so the bytes of a running transfer stay owned by the
+ * channel (tail is only moved once the chain has finished) and producers can not overwrite them.
+ *
+ * 3. Producers run in main and in ISRs. A line is reserved (logdma_g_reserved) and later committed in
+ * two short critical sections, the copy between them runs with interrupts enabled, so an ISR is never
+ * delayed by the length of a message. The bytes between head and reserved are not sent yet. An ISR
+ * which preempts a producer reserves behind it and finishes first (interrupts nest), so the writer
+ * count reaches 0 only when every reserved byte has been copied - that producer moves head up to
+ * reserved. The output of an ISR therefore waits for the copy of the line it interrupted, which
+ * keeps the order of the ring. The room check uses reserved - tail, so reserved spans are never
+ * handed to the DMA or overwritten. The commit also serializes the access to the DMA channel.
+ *
+ * 4. One burst moves one byte per request of the UART (TX FIFO not full), CY_DMA_TD_INC_SRC_ADR walks
+ * through the ring while the destination stays the TX data register. The chain ends with
+ * CY_DMA_DISABLE_TD, so CY_DMA_STATUS_CHAIN_ACTIVE drops when the last byte has been moved.
+ *
+ * 5. The host build (host/Makefile, ta_demo_dma) compiles this path with DMA_LOG__DRQ_NUMBER defined.
+ * A host pointer does not fit the 16 bit TD address, HostSim.c hands out handles for the addresses
+ * instead and moves the bytes at the UART rate, so the ring and the TD handoff run like on the target.
+ */
+
+/* [LogDma.c] END OF FILE */
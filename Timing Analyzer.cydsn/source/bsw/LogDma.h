@@ -0,0 +1,111 @@
+/**
+* \file <LogDma.h>
+* \author <AGILAN V S>
+* \date <22-10-2025>
+*
+* \brief Non-blocking UART_LOG output through a RAM ring drained by DMA
+*
+* UART_LOG_PutString waits on the 4 byte TX FIFO until the last character is handed over, so a
+* status line of 100 characters blocks the caller for ~9ms at 115200 baud. LogDma_PutString and
+* LogDma_PutArray only copy the bytes into a RAM ring and return. The ring is sent by a DMA
+* channel which moves one byte into the TX FIFO per request of the UART, the CPU is only involved
+* to hand the next block of the ring to the channel (LogDma_Process).
+*
+* DMA path: add a DMA component named DMA_LOG to TopDesign and connect its drq input to the
+* tx_interrupt output of UART_LOG with the TX interrupt source "FIFO not full" (hardware request
+* level sensitive). As long as the design has no DMA_LOG (cyfitter.h defines DMA_LOG__DRQ_NUMBER),
+* LogDma_Process feeds the TX FIFO by software without waiting, which keeps the API non-blocking.
+*
+* \copyright Copyright ©2016
+* Department of electrical engineering and information technology, Hochschule Darmstadt - University of applied sciences (h_da). All Rights Reserved.
+* Permission to use, copy, modify, and distribute this software and its documentation for educational, and research purposes in the context of non-commercial
+* (unless permitted by h_da) and official h_da projects, is hereby granted for enrolled students of h_da, provided that the above copyright notice,
+* this paragraph and the following paragraph appear in all copies, modifications, and distributions.
+* Contact Prof.Dr.-Ing. Peter Fromm, peter.fromm@h-da.de, Birkenweg 8 64295 Darmstadt - GERMANY for commercial requests.
+*
+* \warning This software is a PROTOTYPE version and is not designed or intended for use in production, especially not for safety-critical applications!
+* The user represents and warrants that it will NOT use or redistribute the Software for such purposes.
+* This prototype is for research purposes only. This software is provided "AS IS," without a warranty of any kind.
+**/
+
+#ifndef LOGDMA_H
+#define LOGDMA_H
+
+#include "global.h"
+
+/*****************************************************************************/
+/* Global pre-processor symbols/macros and type declarations                 */
+/*****************************************************************************/
+
+//####################### Defines/Macros
+/** \brief Size of the log ring in byte, power of two, at most 2048 (one TD moves up to 4095 byte) */
+#ifndef LOGDMA_BUFFER_SIZE
+#define LOGDMA_BUFFER_SIZE      (2048U)
+#endif
+
+#if ((LOGDMA_BUFFER_SIZE & (LOGDMA_BUFFER_SIZE - 1U)) != 0U) || (LOGDMA_BUFFER_SIZE > 2048U)
+#error "LOGDMA_BUFFER_SIZE must be a power of two of at most 2048"
+#endif
+
+/*****************************************************************************/
+/* API functions                                                             */
+/*****************************************************************************/
+
+/**
+ * Func to initialize the ring and, when present, the DMA_LOG channel and its TDs. Call once after UART_LOG_Start.
+ * \param None
+ * \return RC_SUCCESS when success and RC_ERROR when no DMA channel or TD could be allocated
+*/
+RC_t LogDma_Init(void);
+
+/**
+ * Func to queue a string for output. Never waits, callable from main and ISRs.
+ * \param const char *const string  : [IN] zero terminated string
+ * \return RC_SUCCESS when queued, RC_ERROR_NULL when the string is null and
+ *         RC_ERROR_BUFFER_FULL when the ring has no room (the whole string is dropped)
+*/
+RC_t LogDma_PutString(const char *const string);
+
+/**
+ * Func to queue a block of bytes for output, e.g. a binary frame. Never waits, callable from main and ISRs.
+ * \param const uint8_t *const data : [IN] bytes
+ * \param uint16_t const length     : [IN] number of bytes
+ * \return RC_SUCCESS when queued, RC_ERROR_NULL when the data pointer is null and
+ *         RC_ERROR_BUFFER_FULL when the ring has no room (the whole block is dropped)
+*/
+RC_t LogDma_PutArray(const uint8_t *const data, uint16_t const length);
+
+/**
+ * Func to queue a string for output, waiting for room when the ring is full. For long reports
+ * (profiles, histograms) which are larger than the ring; main context only, never from an ISR.
+ * \param const char *const string  : [IN] zero terminated string, at most LOGDMA_BUFFER_SIZE characters
+ * \return RC_SUCCESS when queued, RC_ERROR_NULL when the string is null and
+ *         RC_ERROR_BUFFER_FULL when the string is longer than the whole ring
+*/
+RC_t LogDma_PutStringWait(const char *const string);
+
+/**
+ * Func to move the output forward: retires the finished DMA transfer and starts the next one
+ * (without DMA: fills the free TX FIFO entries). Called by the put functions, call it from the idle loop as well.
+ * \param None
+ * \return RC_SUCCESS when the ring is empty and RC_ERROR_BUSY while output is pending
+*/
+RC_t LogDma_Process(void);
+
+/**
+ * Func to wait until all queued output has been handed to the UART, e.g. before a reset.
+ * \param None
+ * \return None
+*/
+void LogDma_Flush(void);
+
+/**
+ * Func which returns the number of bytes lost because the ring was full.
+ * \param None
+ * \return number of dropped bytes since LogDma_Init
+*/
+uint32_t LogDma_GetDropped(void);
+
+#endif /* LOGDMA_H */
+
+/* [LogDma.h] END OF FILE */
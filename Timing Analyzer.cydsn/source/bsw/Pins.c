@@ -39,4 +39,22 @@ void Pin_3_Control(uint8_t state)
     GREEN_LED_Write(state);
 }
 
+/* Bit-band wrapper for RED LED */
+void Pin_1_BitBand(uint8_t state)
+{
+    PIN_1_BB_WRITE(state);
+}
+
+/* Bit-band wrapper for YELLOW LED */
+void Pin_2_BitBand(uint8_t state)
+{
+    PIN_2_BB_WRITE(state);
+}
+
+/* Bit-band wrapper for GREEN LED */
+void Pin_3_BitBand(uint8_t state)
+{
+    PIN_3_BB_WRITE(state);
+}
+
 /* [Pins.c] END OF FILE */
@@ -14,14 +14,33 @@
 #define PINS_H
 
 #include "cytypes.h"
+#include "global.h"
 #include "project.h"   /* Required for RED_LED_Write(), etc. */
 
+/* Cortex-M3 bit-band: every bit of the peripheral region 0x40000000..0x400FFFFF has its own word in the
+ * alias region. Bit 0 of a store there sets/clears just this bit in one bus access, no read-modify-write */
+#define PINS_PERIPH_BASE                (0x40000000UL)
+#define PINS_BITBAND_BASE               (0x42000000UL)
+#define PINS_BITBAND(dr, shift)         (*(reg32 *)(PINS_BITBAND_BASE + (((uint32)(dr) - PINS_PERIPH_BASE) << 5U) + ((uint32)(shift) << 2U)))
+
+#if (ARCHITECTURE == ARCH_HOST)
+/* The host has no bit-band region, HostSim.c models the store */
+#define PINS_BITBAND_WRITE(dr, shift, state)    HOST_writeBitBand((uintptr_t)(dr), (uint8)(shift), (uint32)(state))
+#else
+#define PINS_BITBAND_WRITE(dr, shift, state)    (PINS_BITBAND((dr), (shift)) = (uint32)(state))
+#endif
+
+/* Inline pin writers for the fast path, e.g. TA_START_DWT_PIN(&ta, PIN_1_BB_WRITE) */
+#define PIN_1_BB_WRITE(state)           PINS_BITBAND_WRITE(RED_LED__DR, RED_LED__SHIFT, (state))
+#define PIN_2_BB_WRITE(state)           PINS_BITBAND_WRITE(YELLOW_LED__DR, YELLOW_LED__SHIFT, (state))
+#define PIN_3_BB_WRITE(state)           PINS_BITBAND_WRITE(GREEN_LED__DR, GREEN_LED__SHIFT, (state))
+
 /**
 * \Hardware pin/LED enum
 *
 * Enum to hold different hardware pins/LEDs used for external timing
 */
- enum {
+ typedef enum {
     PIN_NONE = 0,   /**< \No pin selected. */
     PIN_RED,        /**< \Pin red selected. */
     PIN_YELLOW,     /**< \Pin yellow selected. */
@@ -38,6 +57,13 @@ extern void Pin_2_Control(uint8_t state);
 
 extern void Pin_3_Control(uint8_t state);
 
+/* Same pins through the bit-band alias: one store, atomic against ISRs writing other pins of the port */
+extern void Pin_1_BitBand(uint8_t state);
+
+extern void Pin_2_BitBand(uint8_t state);
+
+extern void Pin_3_BitBand(uint8_t state);
+
 #endif /* PINS_H */
 
 
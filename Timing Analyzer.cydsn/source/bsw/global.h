@@ -69,6 +69,9 @@
     //#include <project.h>    //Delay etc. 
 #elif(ARCHITECTURE== ARCH_ESP32)
 
+#elif(ARCHITECTURE== ARCH_HOST)
+    //The host C library defines the fixed width types itself, with 'long' being 64 bit
+    #include <stdint.h>
 #else
 #error "Unknown Target"
 #endif
@@ -135,12 +138,25 @@
         vTaskDelayUntil( &__LastWakeTime,   \
         ms*portTICK_PERIOD_MS);}            \
 
+#elif(ARCHITECTURE==ARCH_HOST)
+    #define DELAY_MS(ms)    CyDelay(ms)         				/**< \brief milliseconds Delay Macro, simulated by the host port*/
+    #define DELAY_US(us)    CyDelayUs(us)       				/**< \brief microseconds Delay Macro, simulated by the host port*/
+
+	#define PPCAT_NX(A, B)  A ## _ ## B							/**< \brief Concatenate A and B with a '_' without expanding them*/
+	#define PPCAT(A, B)     PPCAT_NX(A, B)						/**< \brief Concatenate A and B with a '_' after expanding them*/
+
 #else /*(ARCHITECTURE== ARCH_PSOC)*/
 	#error "Unknown Target"
 #endif
 
 //-------------------------------------------------------------------- [Datatypes and related definitions]
 
+#if(ARCHITECTURE==ARCH_HOST)
+typedef int8_t     			sint8_t;            /**< \brief         -128 .. +127            */
+typedef int16_t    			sint16_t;           /**< \brief       -32768 .. +32767          */
+typedef int32_t    			sint32_t;           /**< \brief  -2147483648 .. +2147483647     */
+typedef int64_t    			sint64_t;           /**< \brief -9223372036854775808 .. +9223372036854775807     */
+#else
 typedef signed 		char    	sint8_t;            /**< \brief         -128 .. +127            */
 typedef unsigned 	char  		uint8_t;            /**< \brief            0 .. 255             */
 typedef signed 		short   	sint16_t;           /**< \brief       -32768 .. +32767          */
@@ -153,6 +169,7 @@ typedef 			float   	float32_t;	        /**< \brief  single precision floating po
 typedef 			double  	float64_t;	        /**< \brief  double precision floating point number (8 byte) */
 typedef signed 		long long   sint64_t;           /**< \brief -9223372036854775808 .. +9223372036854775807     */
 typedef unsigned 	long long 	uint64_t;           /**< \brief                    0 .. 18446744073709551615     */
+#endif
 typedef unsigned	char  		boolean_t; 	        /**< \brief  for use with TRUE/FALSE        */
 typedef 			char    	char_t;		        /**< \brief	Character Datatype*/
 